@@ -1,7 +1,7 @@
 #include <rknn_matmul_api.h>
 #include <iostream>
 #include <vector>
-#include <random>
+#include <string>
 #include <chrono>
 #include <span>
 #include <cstring>
@@ -11,6 +11,8 @@
 #include <iomanip>
 #include <csignal>
 
+#include "data_gen.h"
+
 // ============================================================
 // RK3588 NPU 3-Core Full Load Stress Test
 // 
@@ -18,7 +20,8 @@
 //       최대 전력 소모 상태를 만들고, 배터리 소모 테스트에 활용
 //
 // 빌드: g++ npu_stress.cpp -o npu_stress -lrknnrt -lpthread -O3 -std=c++20
-// 실행: taskset -c 4-7 ./npu_stress          (A76 코어에서 실행 권장)
+// 실행: taskset -c 4-7 ./npu_stress [M K N type] [--seed N]   (A76 코어에서 실행 권장)
+//       FP16 입력 분포: --fp16-dist uniform|normal|weight|raw  --fp16-scale X  (data_gen.h)
 //
 // NPU 코어 스펙 (per core):
 //   - 1GHz clock
@@ -27,15 +30,13 @@
 //   - INT4: 2048 ops/cycle = ~2 TOPS/core → 6 TOPS total
 // ============================================================
 
-template <typename T, typename U>
-void fill_random(std::span<T> data, U min, U max)
+// 입력 데이터: Philox counter-based generator (data_gen.h)
+// (seed, data_id, A/B, index) 로 결정 → 같은 --seed 면 bit-exact 재현, 멀티스레드 생성
+template <typename T>
+void fill_random(std::span<T> data, T min, T max, uint32_t data_id, char tensor)
 {
-    using Dist = std::conditional_t<std::is_integral_v<T>,
-        std::uniform_int_distribution<T>, std::uniform_real_distribution<T>>;
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    Dist dis(min, max);
-    for (auto& x : data) x = dis(gen);
+    datagen::fill_uniform(data.data(), data.size(), min, max,
+                          datagen::seed(), datagen::tensor_stream(data_id, tensor));
 }
 
 struct RKNNMatMul
@@ -49,7 +50,7 @@ struct RKNNMatMul
     bool valid = false;
 
     RKNNMatMul(int m, int k, int n, rknn_matmul_type type,
-               bool ac_native = true, bool b_native = true)
+               bool ac_native = true, bool b_native = true, uint32_t data_id = 0)
         : m(m), k(k), n(n), type(type)
     {
         memset(&info, 0, sizeof(info));
@@ -79,14 +80,17 @@ struct RKNNMatMul
         void* b_data = malloc(b_bytes);
 
         if (type == RKNN_INT8_MM_INT8_TO_INT32) {
-            fill_random(std::span<int8_t>((int8_t*)a_data, m*k), -128, 127);
-            fill_random(std::span<int8_t>((int8_t*)b_data, k*n), -128, 127);
+            fill_random<int8_t>(std::span<int8_t>((int8_t*)a_data, m*k), -128, 127, data_id, 'A');
+            fill_random<int8_t>(std::span<int8_t>((int8_t*)b_data, k*n), -128, 127, data_id, 'B');
         } else if (type == RKNN_FLOAT16_MM_FLOAT16_TO_FLOAT32) {
-            fill_random(std::span<uint16_t>((uint16_t*)a_data, m*k), -1.0, 1.0);
-            fill_random(std::span<uint16_t>((uint16_t*)b_data, k*n), -1.0, 1.0);
+            // fp32 분포에서 뽑아 IEEE half 로 변환 (--fp16-dist, 기본 uniform ±1)
+            datagen::fill_fp16((uint16_t*)a_data, (size_t)m*k, 'A', k, datagen::seed(),
+                               datagen::tensor_stream(data_id, 'A'));
+            datagen::fill_fp16((uint16_t*)b_data, (size_t)k*n, 'B', k, datagen::seed(),
+                               datagen::tensor_stream(data_id, 'B'));
         } else {
-            fill_random(std::span<int8_t>((int8_t*)a_data, m*k/2), -8, 7);
-            fill_random(std::span<int8_t>((int8_t*)b_data, k*n/2), -8, 7);
+            fill_random<int8_t>(std::span<int8_t>((int8_t*)a_data, m*k/2), -8, 7, data_id, 'A');
+            fill_random<int8_t>(std::span<int8_t>((int8_t*)b_data, k*n/2), -8, 7, data_id, 'B');
         }
 
         A = rknn_create_mem(ctx, attr.A.size);
@@ -132,7 +136,7 @@ void stress_worker(int core_id, int m, int k, int n,
                    CoreStats& stats)
 {
     // native layout = 최대 성능 (SRAM 최적화된 데이터 배치)
-    RKNNMatMul matmul(m, k, n, type, /*ac_native=*/true, /*b_native=*/true);
+    RKNNMatMul matmul(m, k, n, type, /*ac_native=*/true, /*b_native=*/true, /*data_id=*/core_id);
     if (!matmul.valid) {
         std::cerr << "[Core " << core_id << "] Init failed!" << std::endl;
         return;
@@ -277,14 +281,30 @@ int main(int argc, char* argv[])
     int N = 4096;
     rknn_matmul_type type = RKNN_INT8_MM_INT8_TO_INT32;
 
-    // Parse optional args
-    if (argc >= 4) {
-        M = std::atoi(argv[1]);
-        K = std::atoi(argv[2]);
-        N = std::atoi(argv[3]);
+    // Parse optional args: [M K N [type]] [--seed N] [--fp16-dist D] [--fp16-scale X]
+    std::vector<char*> pos;
+    for (int i = 1; i < argc; i++) {
+        const std::string a = argv[i];
+        if (a == "--seed" && i + 1 < argc)
+            datagen::set_seed(std::strtoull(argv[++i], nullptr, 0));
+        else if (a == "--fp16-dist" && i + 1 < argc) {
+            if (!datagen::parse_fp16_dist(argv[++i], datagen::params().fp16)) {
+                std::cerr << "Unknown --fp16-dist: " << argv[i] << " (uniform|normal|weight|raw)\n";
+                return 1;
+            }
+        }
+        else if (a == "--fp16-scale" && i + 1 < argc)
+            datagen::params().scale = std::atof(argv[++i]);
+        else
+            pos.push_back(argv[i]);
+    }
+    if (pos.size() >= 3) {
+        M = std::atoi(pos[0]);
+        K = std::atoi(pos[1]);
+        N = std::atoi(pos[2]);
     }
-    if (argc >= 5) {
-        int t = std::atoi(argv[4]);
+    if (pos.size() >= 4) {
+        int t = std::atoi(pos[3]);
         if (t == 0) type = RKNN_INT8_MM_INT8_TO_INT32;
         else if (t == 1) type = RKNN_FLOAT16_MM_FLOAT16_TO_FLOAT32;
         else if (t == 2) type = RKNN_INT4_MM_INT4_TO_INT16;
@@ -293,6 +313,11 @@ int main(int argc, char* argv[])
     std::cout << "Matrix size: M=" << M << " K=" << K << " N=" << N << "\n";
     std::cout << "Ops per matmul: "
               << (uint64_t)M * N * (2ULL*K - 1) / 1e9 << " GOPS\n";
+    std::cout << "Data seed: " << datagen::seed();
+    if (type == RKNN_FLOAT16_MM_FLOAT16_TO_FLOAT32)
+        std::cout << ", fp16 " << datagen::fp16_dist_name(datagen::params().fp16)
+                  << " scale " << datagen::params().scale;
+    std::cout << "\n";
 
     // 3 코어 각각에 독립 matmul 인스턴스
     CoreStats stats[3];
@@ -0,0 +1,104 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <string>
+#include <vector>
+#include <sstream>
+#include <cerrno>
+#include <sys/stat.h>
+
+// ============================================================
+// Shared helpers for bench_robot.cpp and its modes
+//
+// 모든 측정 타임스탬프는 하나의 monotonic clock (steady_clock)
+// 기준으로 기록한다. bench_t0() = 프로세스 시작 시점.
+// ============================================================
+
+using bench_clock = std::chrono::steady_clock;
+
+inline bench_clock::time_point bench_t0()
+{
+    static const bench_clock::time_point t0 = bench_clock::now();
+    return t0;
+}
+
+// ns since bench_t0()
+inline uint64_t bench_now_ns()
+{
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        bench_clock::now() - bench_t0()).count();
+}
+
+inline uint64_t elapsed_ns(bench_clock::time_point t0, bench_clock::time_point t1)
+{
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count();
+}
+
+// "0,2,4-7" → {0,2,4,5,6,7}
+inline std::vector<int> parse_int_list(const std::string& s)
+{
+    std::vector<int> out;
+    std::stringstream ss(s);
+    std::string tok;
+    while (std::getline(ss, tok, ',')) {
+        if (tok.empty()) continue;
+        auto dash = tok.find('-', 1);
+        if (dash != std::string::npos) {
+            int lo = std::stoi(tok.substr(0, dash));
+            int hi = std::stoi(tok.substr(dash + 1));
+            for (int v = lo; v <= hi; v++) out.push_back(v);
+        } else {
+            out.push_back(std::stoi(tok));
+        }
+    }
+    return out;
+}
+
+// "a,b,c" → {"a","b","c"}
+inline std::vector<std::string> parse_name_list(const std::string& s)
+{
+    std::vector<std::string> out;
+    std::stringstream ss(s);
+    std::string tok;
+    while (std::getline(ss, tok, ','))
+        if (!tok.empty()) out.push_back(tok);
+    return out;
+}
+
+// thread별 누적 counter. cache line 단위로 분리해 false sharing 방지.
+struct alignas(64) PaddedCounter {
+    std::atomic<uint64_t> v{0};
+};
+
+// ns sample 들의 median (us)
+inline double median_us(std::vector<uint64_t> v)
+{
+    if (v.empty()) return 0.0;
+    std::sort(v.begin(), v.end());
+    const size_t h = v.size() / 2;
+    return (v.size() % 2 ? v[h] : (v[h - 1] + v[h]) / 2) / 1e3;
+}
+
+// "mkdir -p"
+inline bool make_dirs(const std::string& path)
+{
+    size_t pos = 0;
+    do {
+        pos = path.find('/', pos + 1);
+        std::string sub = path.substr(0, pos);
+        if (mkdir(sub.c_str(), 0755) != 0 && errno != EEXIST) return false;
+    } while (pos != std::string::npos);
+    return true;
+}
+
+// 20240101_123000 (로컬 시간, 결과 디렉터리 이름용)
+inline std::string timestamp_str()
+{
+    char buf[32];
+    std::time_t t = std::time(nullptr);
+    std::strftime(buf, sizeof(buf), "%Y%m%d_%H%M%S", std::localtime(&t));
+    return buf;
+}
@@ -0,0 +1,139 @@
+#pragma once
+#include <rknn_matmul_api.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "sysfs.h"
+
+// 내장 CPU 부하 (cpu_load.h)
+struct CpuLoadConfig {
+    std::vector<int> cores = {0, 1, 2, 3, 4, 5, 6, 7};
+    int load_a55  = 50;      // % duty, A55 cluster
+    int load_a76  = 50;      // % duty, A76 clusters
+    int period_ms = 100;     // PWM 주기
+};
+
+// STREAM copy/triad worker (mem_bw.h)
+struct MemBwConfig {
+    int         threads = 2;
+    int         mb = 256;            // thread당 buffer 크기 (모든 배열 합)
+    std::string kernel = "triad";    // copy | triad
+    std::vector<int> cores;          // 비어있으면 pin 하지 않음
+};
+
+// 제어 loop jitter probe (rt_probe.h)
+struct RtProbeConfig {
+    int cpu     = -1;      // -1 = probe 끔
+    int rt_prio = 80;      // SCHED_FIFO (0 = SCHED_OTHER)
+    int hz      = 1000;
+    int work_us = 0;       // cycle당 busy 계산 시간
+};
+
+// ============================================================
+// bench_robot 전체 옵션 (main에서 parse, 각 mode가 참조)
+// ============================================================
+struct BenchConfig {
+    // matmul shape / type (positional: M K N type)
+    int M = 1024, K = 4096, N = 4096;
+    rknn_tensor_type type = RKNN_TENSOR_INT8;
+    bool shape_set = false;        // positional M K N 지정 여부 (submit mode 기본 shape 판단)
+
+    std::string mode = "stress";
+
+    // thermal sampler
+    Sysfs sysfs;
+    int   sample_ms = 100;
+
+    // stress mode outputs
+    std::string csv_path;
+    std::string run_log_path;
+
+    // phase 기반 mode (orchestrate, ddr)
+    int         phase_sec = 60;
+    std::string phases = "baseline,cpu,npu,both";
+    std::string out_dir;            // 비어있으면 rk3588_orchestrate_<timestamp>
+
+    // orchestrate / ddr mode workload
+    CpuLoadConfig cpu_load;
+    MemBwConfig   mem;
+
+    // interference mode (interference.h)
+    std::string classes = "npu_int8,npu_gemv,npu_fp16,cpu_compute,cpu_mem,cpu_latency";
+    int         lat_cpu = 0;       // cpu_latency loop core (cpu_compute에서 제외)
+
+    // thread placement (thread_placement.h): stress / placement mode
+    std::vector<int> worker_cpus;  // worker i → worker_cpus[i], 비어있으면 floating
+    int monitor_cpu     = -1;
+    int rt_prio         = 0;       // worker SCHED_FIFO priority (0 = off)
+    int monitor_rt_prio = 0;
+
+    // wake mode (wake_latency.h): idle gap sweep
+    std::string wake_gaps  = "0,1,2,5,10,20,50,100,200,500,1000,2000,5000";   // ms
+    std::string wake_types = "int8,fp16";
+    int         wake_reps  = 5;
+
+    // startup mode (startup_sweep.h): K × N 별 context 생성 비용
+    std::string startup_k    = "64,256,1024,4096";
+    std::string startup_n    = "64,256,1024,4096";
+    int         startup_reps = 3;       // init mode 도 같은 반복 수
+    bool        staged_init  = false;   // host buffer → memcpy 경로 (비교용)
+    bool        shared_b     = false;   // stress mode: B 1벌을 3 context 가 공유
+
+    // dvfs mode (dvfs_sweep.h)
+    std::string dvfs_freqs;          // MHz 목록, 비어있으면 available_frequencies
+    std::string dvfs_cpu_gov;        // 비어있으면 CPU governor 그대로
+    int         dvfs_settle_ms = 2000;
+
+    // governor mode (thermal_governor.h): PID duty-cycle 로 온도 target 추종
+    double gov_target_c     = 80.0;
+    double gov_kp           = 0.05;    // duty / °C
+    double gov_ki           = 0.01;    // duty / (°C·s)
+    double gov_kd           = 0.02;    // duty / (°C/s)
+    double gov_min_duty     = 0.05;
+    int    gov_period_ms    = 500;
+    int    gov_cooldown_sec = 60;      // uncontrolled → governed 사이 idle
+
+    // sim mode (thermal_sim.h): RC model 이 --sysfs-root 에 fake tree 기록
+    std::string sim_profile = "idle:60,npu:600,both:600,idle:300";
+    std::string sim_params;          // fit_thermal_model.py 출력 (key=value)
+    double      sim_speed = 1.0;     // sim 초 / wall 초
+
+    // stress mode: time-to-throttle forecast + steady-state 감지 (thermal_forecast.h)
+    double trip_c        = 0;        // 0 = NPU zone 의 passive trip point
+    int    steady_window = 120;      // 초
+    double steady_ci_pct = 1.0;      // GOPS 95% CI 반폭 (%)
+    double steady_slope  = 0.2;      // |°C/min|
+    bool   stop_at_steady = false;
+
+    // stress mode 종료 조건 (stop_condition.h), 0 = 사용 안 함
+    int      duration_sec = 0;
+    uint64_t iterations   = 0;       // core당
+    double   until_ci_pct = 0;       // 평균 latency 95% CI 반폭 (%)
+
+    uint64_t    seed = 1;            // A/B 입력 데이터 seed (data_gen.h)
+    std::string fp16_dist  = "uniform";   // uniform | normal | weight | raw
+    double      fp16_scale = 1.0;
+
+    // maxshape mode (shape_limit.h): type × core 수 별 최대 feasible shape
+    std::string maxshape_types = "int8,fp16";
+    std::string maxshape_cores = "1,3";
+    std::string maxshape_grow  = "all";     // all | m | k | n | kn
+    int         maxshape_max   = 16384;     // s 상한
+    int         maxshape_sec   = 5;         // 한계 shape 에서 GOPS 측정 시간
+
+    // pool mode (pool_replay.h): shape mix replay, context pool 유무
+    std::string pool_shapes =
+        "1x2048x2048:40,8x2048x2048:20,32x2048x2048:10,1x4096x4096:15,64x4096x4096:5,1x2048x8192:10";
+    int         pool_ops       = 2000;
+    int         pool_budget_mb = 64;
+    int         pool_cores     = 1;
+
+    // data mode (data_sweep.h): 입력 pattern 별 GOPS / power / 온도
+    std::string data_patterns     = "random,sparse:50,sparse:90,const:1,zeros";
+    std::string data_apply        = "ab";    // a | b | ab
+    int         data_cooldown_sec = 30;
+
+    // control-loop jitter probe: stress / orchestrate mode에서 같이 실행
+    RtProbeConfig rt_probe;
+};
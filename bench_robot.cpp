@@ -8,7 +8,33 @@
 #include <atomic>
 #include <fstream>
 #include <iomanip>
+#include <memory>
 #include <csignal>
+#include <string>
+
+#include "bench_common.h"
+#include "bench_config.h"
+#include "data_sweep.h"
+#include "dvfs_sweep.h"
+#include "npu_matmul.h"
+#include "interference.h"
+#include "mem_bw.h"
+#include "orchestrator.h"
+#include "placement_compare.h"
+#include "pool_replay.h"
+#include "rt_probe.h"
+#include "run_log.h"
+#include "shape_limit.h"
+#include "shared_weight.h"
+#include "start_barrier.h"
+#include "startup_sweep.h"
+#include "stop_condition.h"
+#include "submit_overhead.h"
+#include "thermal_forecast.h"
+#include "thermal_governor.h"
+#include "thermal_sampler.h"
+#include "thermal_sim.h"
+#include "wake_latency.h"
 
 // ============================================================
 // RK3588 NPU 3-Core Full Load Stress Test
@@ -19,167 +45,204 @@
 // NPU 코어 스펙 (per core):
 //   INT8:  ~1 TOPS/core  → 3 TOPS total
 //   FP16:  ~0.5 TFLOPS   → 1.5 TFLOPS total
+//
+// Options (positional M K N type 뒤에):
+//   --sysfs-root DIR   sysfs prefix (fake tree 테스트용, 기본 "")
+//   --sample-ms N      thermal sampler 주기 (기본 100)
+//   --csv FILE         1초 interval CSV (GOPS + thermal state)
+//   --run-log FILE     run 단위 CSV (latency + thermal state)
+//   --worker-cpus LIST worker i 를 LIST[i] core에 고정 (taskset 대체)
+//   --monitor-cpu N    monitor thread core
+//   --rt-prio N        worker SCHED_FIFO priority (--monitor-rt-prio 별도)
+//   --rt-probe-cpu N   1 kHz 제어 loop jitter probe 를 core N 에서 같이 실행 (rt_probe.h)
+//   --rt-probe-prio N / --rt-probe-hz N / --rt-probe-work-us N   (기본 80 / 1000 / 0)
+//                      stress, orchestrate mode 에서 사용 (orchestrate는 phase별 결과)
+//   --trip-c T         throttle 예측 기준 온도 (기본 NPU zone passive trip point, 없으면 85)
+//   --steady-window N  steady-state 판정 window 초 (기본 120)
+//   --steady-ci PCT    GOPS 95% CI 반폭 기준 (기본 1.0%)
+//   --steady-slope X   NPU 온도 기울기 기준 °C/min (기본 0.2)
+//   --stop-at-steady   steady state 가 되면 자동 종료 (stress mode)
+//   --duration SEC     stress mode 측정 시간 (기본 0 = Ctrl+C / SIGTERM 까지)
+//   --iterations N     core당 run 횟수
+//   --until-ci PCT     평균 latency 95% CI 반폭이 PCT% 이하가 되면 종료 (stop_condition.h)
+//   --seed N           A/B 입력 데이터 seed (기본 1). 같은 seed = bit-exact 같은 데이터
+//   --fp16-dist D      FP16 입력 분포 uniform | normal | weight | raw (기본 uniform)
+//   --fp16-scale X     uniform ±X / normal σ=X / weight: A σ=X, B Laplace std X/√K (기본 1)
+//   --mode MODE        stress (기본) | orchestrate | ddr | interference | placement
+//                      | submit | wake | startup | init | shared-b | maxshape | pool | dvfs
+//                      | data | governor | sim
+//   --staged-init      A/B 를 host buffer 에 만든 뒤 memcpy (이전 방식, 기본은 DMA buffer 에 직접)
+//   --shared-b         stress mode: core 0 의 B 하나를 3 context 가 같이 bind (weight 공유)
+//
+// orchestrate mode (run_stress_test.sh 대체, orchestrator.h):
+//   --phase-sec N      phase 길이 (기본 60)
+//   --phases LIST      기본 baseline,cpu,npu,both
+//   --cpu-cores LIST   CPU 부하 core 목록 (기본 0-7, core당 worker 1개 고정)
+//   --cpu-load PCT     모든 core duty cycle (기본 50)
+//   --cpu-load-a55 PCT / --cpu-load-a76 PCT   cluster별 duty cycle
+//   --cpu-period-ms N  PWM 주기 (기본 100)
+//   --out DIR          결과 디렉터리 (기본 rk3588_orchestrate_<time>)
+//
+// ddr mode (mem_bw.h): npu → mem → both, phase 길이는 --phase-sec
+//   --mem-threads N    STREAM worker 수 (기본 2)
+//   --mem-mb N         thread당 buffer MB (기본 256)
+//   --mem-kernel K     copy | triad (기본 triad)
+//   --mem-cores LIST   worker pin 할 core (기본 pin 안함)
+//   --csv FILE         1초 timeline
+//
+// interference mode (interference.h): 단독 + 모든 pair → N x N slowdown
+//   --classes LIST     npu_int8,npu_gemv,npu_fp16,cpu_compute,cpu_mem,cpu_latency
+//   --lat-cpu N        cpu_latency loop core (기본 0)
+//   --out DIR          timeline.csv + matrix.csv 저장
+//
+// placement mode (placement_compare.h): floating / pinned / rt 별
+// rknn_matmul_run latency jitter 비교 (--worker-cpus, --rt-prio 사용)
+//
+// submit mode (submit_overhead.h): 최소 shape (기본 1x32x32, positional로 변경)
+// NPU core 1개 / 3개 back-to-back → max runs/s, call당 host CPU us, user/kernel 비율
+//   --phase-sec N      case당 측정 시간
+//
+// wake mode (wake_latency.h): idle gap 뒤 첫 run latency, core × type 별
+//   --wake-gaps LIST   idle gap ms (기본 0,1,2,5,10,20,50,100,200,500,1000,2000,5000)
+//   --wake-types LIST  int8,fp16
+//   --wake-reps N      gap당 반복 (기본 5, median 보고)
+//   --csv FILE         sample 단위 기록
+//
+// startup mode (startup_sweep.h): K × N 마다 context 생성 단계별 시간 (median)
+// create / core_mask / create_mem A,B,C / fill / memcpy / set_io_mem / 첫 run / destroy
+//   --startup-k LIST   기본 64,256,1024,4096 (M 은 positional M K N 의 M, 기본 1)
+//   --startup-n LIST   기본 64,256,1024,4096
+//   --startup-reps N   shape 당 반복 (기본 3)
+//   --csv FILE         rep 단위 기록
+//
+// init mode (startup_sweep.h): 3-core context 입력 초기화 direct vs staged
+// init 시간 / fill / memcpy / peak RSS 증가분 (VmHWM), 반복은 --startup-reps
+//
+// shared-b mode (shared_weight.h): private B → shared B → private B, 각 --phase-sec
+// 3-core GOPS, core별 GOPS, p50 / p99 latency, DMA footprint 비교
+//
+// maxshape mode (shape_limit.h): type × core 수 마다 생성 가능한 최대 shape (binary search)
+// 한계 shape 의 DMA MB / host peak RSS / GOPS. stress summary 에도 context 별 A/B/C 크기 출력
+//   --maxshape-types LIST  int8,fp16 (기본 둘 다)
+//   --maxshape-cores LIST  context 수 = 사용 core 수 (기본 1,3)
+//   --maxshape-grow G      all (M=K=N=s) | m | k | n | kn, 나머지는 positional (기본 all)
+//   --maxshape-max N       s 상한 (기본 16384), 탐색 단위 64
+//   --maxshape-sec N       한계 shape 에서 GOPS 측정 시간 (기본 5)
+//   --csv FILE             결과
+//
+// pool mode (pool_replay.h): shape mix 를 같은 순서로 context pool 없이 / 있이 재생
+// hit rate, eviction 비용, op latency p50 / p99 / p99.9 (op = acquire 또는 생성 + run)
+//   --pool-shapes LIST  MxKxN[:weight],... (기본 1x2048x2048:40,8x2048x2048:20,...)
+//   --pool-ops N        op 수 (기본 2000), 순서는 --seed 로 고정
+//   --pool-budget-mb N  pool DMA budget (기본 64), 넘으면 LRU evict
+//   --pool-cores N      op i 를 core i % N 에서 실행 (기본 1)
+//   --csv FILE          결과
+//
+// dvfs mode (dvfs_sweep.h): NPU devfreq OPP 마다 min=max 고정 → GOPS / W / 온도
+//   --dvfs-freqs LIST  MHz 목록 (기본 available_frequencies 전체)
+//   --dvfs-cpu-gov G   cpufreq policy governor 도 고정 (예: performance)
+//   --dvfs-settle-ms N OPP 변경 후 대기 (기본 2000), 측정은 --phase-sec
+//   --csv FILE         OPP 별 결과. 종료 시 원래 설정 복원
+//
+// data mode (data_sweep.h): 입력 data pattern 마다 context 새로 생성 → GOPS / W / 온도 slope
+//   --data-patterns LIST  random | zeros | const:X | sparse:PCT | file:PATH
+//                         (기본 random,sparse:50,sparse:90,const:1,zeros)
+//   --data-apply a|b|ab   pattern 을 적용할 tensor (기본 ab, 나머지는 random)
+//   --data-cooldown-sec N pattern 사이 idle (기본 30), 측정은 --phase-sec
+//   --csv FILE            pattern 별 결과
+//
+// governor mode (thermal_governor.h): uncontrolled → cooldown → PID governed
+//   --gov-target-c T   NPU 온도 target (기본 80)
+//   --gov-kp / --gov-ki / --gov-kd   PID gain (기본 0.05 / 0.01 / 0.02)
+//   --gov-min-duty D   최소 issue duty (기본 0.05)
+//   --gov-period-ms N  제어 주기 (기본 500)
+//   --gov-cooldown-sec N  phase 사이 idle (기본 60), phase 길이는 --phase-sec
+//   --csv FILE         제어 주기별 온도 / duty / GOPS
+//
+// sim mode (thermal_sim.h): RC thermal model → --sysfs-root 에 fake tree
+// logger / plotter 와 sysfs 읽기 경로 시험용, activity 는 --sim-profile (open-loop)
+// (다른 터미널에서 bench --sysfs-root 같은 경로, SYSFS_ROOT=... thermal_logger.sh)
+// governor / dvfs 는 여전히 실제 NPU 를 쓰고, sim 에는 devfreq max_freq 만 반영됨
+//   --sim-profile LIST idle|cpu|npu|both:sec,... (기본 idle:60,npu:600,both:600,idle:300)
+//   --sim-params FILE  fit_thermal_model.py 결과
+//   --sim-speed X      sim 시간 배속 (기본 1)
+//   --csv FILE         sim step 기록 (주기 --sample-ms)
 // ============================================================
 
-// -------- C++17 호환 fill_random (std::span 제거) --------
-template <typename T>
-void fill_random(T* data, size_t count, T min_val, T max_val)
-{
-    using Dist = typename std::conditional<std::is_integral<T>::value,
-        std::uniform_int_distribution<T>,
-        std::uniform_real_distribution<T>>::type;
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    Dist dis(min_val, max_val);
-    for (size_t i = 0; i < count; ++i)
-        data[i] = dis(gen);
-}
-
-// -------- NPU 코어 마스크 배열 (Core 0, 1, 2) --------
-static const rknn_core_mask CORE_MASKS[3] = {
-    RKNN_NPU_CORE_0,
-    RKNN_NPU_CORE_1,
-    RKNN_NPU_CORE_2,
-};
-
-// ============================================================
-// RKNNMatMul wrapper
-// ============================================================
-struct RKNNMatMul
-{
-    int m, k, n;
-    rknn_tensor_type type;      // 실제 헤더: rknn_tensor_type
-    rknn_matmul_ctx  ctx = 0;
-    rknn_matmul_info info;
-    rknn_matmul_io_attr attr;
-    rknn_tensor_mem *A = nullptr, *B = nullptr, *C = nullptr;
-    bool valid = false;
-
-    // native_layout : B 행렬 native layout (0=normal, 1=native)
-    // perf_layout   : A/C 행렬 perf layout  (0=normal, 1=perf)
-    // core_mask     : 이 인스턴스를 실행할 NPU 코어
-    RKNNMatMul(int m, int k, int n, rknn_tensor_type type,
-               int native_layout, int perf_layout,
-               rknn_core_mask core_mask = RKNN_NPU_CORE_AUTO)
-        : m(m), k(k), n(n), type(type)
-    {
-        memset(&info, 0, sizeof(info));
-        info.M             = m;
-        info.K             = k;
-        info.N             = n;
-        info.type          = type;
-        info.native_layout = native_layout;
-        info.perf_layout   = perf_layout;
-
-        memset(&attr, 0, sizeof(attr));
-        int ret = rknn_matmul_create(&ctx, &info, &attr);
-        if (ret != 0) {
-            std::cerr << "rknn_matmul_create failed: " << ret << std::endl;
-            return;
-        }
-
-        // 코어 고정
-        ret = rknn_matmul_set_core_mask(ctx, core_mask);
-        if (ret != 0) {
-            std::cerr << "rknn_matmul_set_core_mask failed: " << ret << std::endl;
-            return;
-        }
-
-        // 입력 데이터 할당 및 초기화
-        size_t a_bytes, b_bytes;
-        if (type == RKNN_TENSOR_INT8) {
-            a_bytes = (size_t)m * k;
-            b_bytes = (size_t)k * n;
-        } else if (type == RKNN_TENSOR_FLOAT16) {
-            a_bytes = (size_t)m * k * 2;
-            b_bytes = (size_t)k * n * 2;
-        } else {
-            std::cerr << "Unsupported type" << std::endl;
-            return;
-        }
-
-        void* a_data = malloc(a_bytes);
-        void* b_data = malloc(b_bytes);
-
-        if (type == RKNN_TENSOR_INT8) {
-            fill_random(reinterpret_cast<int8_t*>(a_data), (size_t)m * k, (int8_t)-128, (int8_t)127);
-            fill_random(reinterpret_cast<int8_t*>(b_data), (size_t)k * n, (int8_t)-128, (int8_t)127);
-        } else {
-            fill_random(reinterpret_cast<uint16_t*>(a_data), (size_t)m * k, (uint16_t)0, (uint16_t)65535);
-            fill_random(reinterpret_cast<uint16_t*>(b_data), (size_t)k * n, (uint16_t)0, (uint16_t)65535);
-        }
-
-        A = rknn_create_mem(ctx, attr.A.size);
-        B = rknn_create_mem(ctx, attr.B.size);
-        C = rknn_create_mem(ctx, attr.C.size);
-        if (!A || !B || !C) {
-            std::cerr << "rknn_create_mem failed" << std::endl;
-            free(a_data); free(b_data);
-            return;
-        }
-
-        memcpy(A->virt_addr, a_data, A->size);
-        memcpy(B->virt_addr, b_data, B->size);
-        free(a_data);
-        free(b_data);
-
-        rknn_matmul_set_io_mem(ctx, A, &attr.A);
-        rknn_matmul_set_io_mem(ctx, B, &attr.B);
-        rknn_matmul_set_io_mem(ctx, C, &attr.C);
-        valid = true;
-    }
-
-    int run() { return rknn_matmul_run(ctx); }
-
-    ~RKNNMatMul()
-    {
-        if (A) rknn_destroy_mem(ctx, A);
-        if (B) rknn_destroy_mem(ctx, B);
-        if (C) rknn_destroy_mem(ctx, C);
-        if (ctx) rknn_matmul_destroy(ctx);
-    }
-};
-
-// ============================================================
-// Per-core stats
-// ============================================================
-struct CoreStats {
-    std::atomic<uint64_t> total_runs{0};
-    std::atomic<uint64_t> total_ns{0};
-    std::atomic<double>   peak_gops{0.0};
-};
-
 // ============================================================
 // Stress worker (코어 1개 담당)
 // ============================================================
 void stress_worker(int core_id, int m, int k, int n,
                    rknn_tensor_type type,
                    std::atomic<bool>& running,
-                   CoreStats& stats)
+                   CoreStats& stats,
+                   const ThermalSampler* sampler,
+                   RunLogRing* run_log,
+                   ThreadPlacement placement,
+                   uint64_t max_runs,            // 0 = 무제한
+                   StartBarrier& barrier,
+                   RKNNMatMul* prebuilt)         // --shared-b: main 이 미리 만든 context
 {
+    apply_placement(placement, "stress_worker");
+
     // native_layout=1, perf_layout=1 → 최대 성능
-    RKNNMatMul matmul(m, k, n, type, 1, 1, CORE_MASKS[core_id]);
+    const auto t_init = bench_clock::now();
+    std::unique_ptr<RKNNMatMul> own;
+    if (!prebuilt) own = std::make_unique<RKNNMatMul>(m, k, n, type, 1, 1, CORE_MASKS[core_id]);
+    RKNNMatMul& matmul = prebuilt ? *prebuilt : *own;
     if (!matmul.valid) {
         std::cerr << "[Core " << core_id << "] Init failed!" << std::endl;
+        barrier.drop();
         return;
     }
-
-    std::cout << "[Core " << core_id << "] Ready: "
-              << m << "x" << k << "x" << n << std::endl;
+    const auto t_warm = bench_clock::now();
+    stats.a_bytes.store(matmul.attr.A.size);
+    stats.b_bytes.store(matmul.attr.B.size);
+    stats.c_bytes.store(matmul.attr.C.size);
+    stats.owns_b.store(matmul.owns_b);
 
     // Warm-up
     for (int i = 0; i < 5; i++) matmul.run();
+    if (prebuilt) stats.init_ns.store(matmul.startup.init_total());
+    else          stats.init_ns.store(elapsed_ns(t_init, t_warm));
+    stats.warmup_ns.store(elapsed_ns(t_warm, bench_clock::now()));
+
+    std::cout << "[Core " << core_id << "] Ready: "
+              << m << "x" << k << "x" << n << " (" << placement.str() << ")"
+              << ", init " << std::fixed << std::setprecision(1) << stats.init_ns.load() / 1e6
+              << " ms, warm-up " << stats.warmup_ns.load() / 1e6 << " ms" << std::endl;
+
+    // 3 core 모두 준비될 때까지 대기 → 같은 t0 에 시작
+    bench_clock::time_point t_start;
+    if (!barrier.arrive(running, t_start)) return;
+    std::this_thread::sleep_until(t_start);
 
     const uint64_t ops_per_run = (uint64_t)m * n * (2ULL * k - 1);
 
-    while (running.load()) {
-        auto t0 = std::chrono::high_resolution_clock::now();
+    // rknn_matmul_run 안에서 sleep 하는지 spin 하는지 → thread CPU time / ctx switch
+    // syscall 부담을 줄이기 위해 매 run이 아니라 10ms 간격으로만 publish
+    const ThreadCpuSample cpu_base = thread_cpu_now();
+    auto last_pub = bench_clock::now();
+    stats.start_offset_ns.store((int64_t)(last_pub - t_start).count());
+    stats.started.store(true);
+
+    while (running.load() && (max_runs == 0 || stats.total_runs.load() < max_runs)) {
+        auto t0 = bench_clock::now();
         matmul.run();
-        auto t1 = std::chrono::high_resolution_clock::now();
+        auto t1 = bench_clock::now();
+
+        if (t1 - last_pub >= std::chrono::milliseconds(10)) {
+            stats.publish_cpu(thread_cpu_now() - cpu_base);
+            last_pub = t1;
+        }
 
-        auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count();
+        uint64_t ns = elapsed_ns(t0, t1);
         double gops = (double)ops_per_run / static_cast<double>(ns); // GOPS
 
+        if (run_log)
+            run_log->push({elapsed_ns(bench_t0(), t1), ns,
+                                sampler ? sampler->latest() : ThermalSnapshot{}});
+
         stats.total_runs.fetch_add(1);
         stats.total_ns.fetch_add(ns);
 
@@ -187,6 +250,7 @@ void stress_worker(int core_id, int m, int k, int n,
         double cur = stats.peak_gops.load();
         while (gops > cur && !stats.peak_gops.compare_exchange_weak(cur, gops)) {}
     }
+    stats.publish_cpu(thread_cpu_now() - cpu_base);
 
     std::cout << "[Core " << core_id << "] Stopped." << std::endl;
 }
@@ -196,60 +260,176 @@ void stress_worker(int core_id, int m, int k, int n,
 // ============================================================
 void monitor_thread(std::atomic<bool>& running,
                     CoreStats* stats,          // CoreStats[3]
-                    rknn_tensor_type type)
+                    rknn_tensor_type type,
+                    uint64_t ops_per_run,
+                    const ThermalSampler* sampler,
+                    std::ofstream* csv,
+                    ThreadPlacement placement,
+                    ThermalForecaster* forecast,
+                    bool stop_at_steady,
+                    StopCondition* stop,
+                    StartBarrier& barrier,
+                    std::atomic<long>* running_rss_kb)   // barrier 직후 VmRSS (memory footprint)
 {
-    const char* type_str;
-    double theoretical_per_core;
-
-    if (type == RKNN_TENSOR_INT8) {
-        type_str = "INT8";
-        theoretical_per_core = 1000.0; // 1 TOPS = 1000 GOPS
-    } else {
-        type_str = "FP16";
-        theoretical_per_core = 500.0;  // 0.5 TFLOPS
-    }
-    const double theoretical_total = theoretical_per_core * 3;
-
+    apply_placement(placement, "monitor");
+
+    // 설계상 core당 peak (cycle 기준): INT8 1 TOPS / FP16 0.5 TFLOPS @ 1 GHz
+    // devfreq 가 clock 을 내리면 GOPS 는 떨어져도 ops/cycle 은 그대로여야 정상 →
+    // 효율은 매 interval 실제 NPU clock 으로 나눈 ops/cycle 로 본다.
+    const char* type_str          = type_name(type);
+    const double peak_ops_per_cyc = (type == RKNN_TENSOR_INT8) ? 1000.0 : 500.0;
+    const double nominal_mhz      = 1000.0;   // cur_freq 를 못 읽을 때만 사용
+
+    auto box = [](std::string t) {
+        t.resize(60, ' ');
+        return "║  " + t + "║\n";
+    };
     std::cout << "\n"
               << "╔══════════════════════════════════════════════════════════════╗\n"
-              << "║  RK3588 NPU 3-Core Stress Test (" << type_str << ")                    ║\n"
-              << "║  Theoretical max: " << std::fixed << std::setprecision(1)
-              << theoretical_total << " GOPS (" << type_str << ")                     ║\n"
-              << "║  Press Ctrl+C to stop                                        ║\n"
+              << box(std::string("RK3588 NPU 3-Core Stress Test (") + type_str + ")")
+              << box("Peak: " + std::to_string((int)peak_ops_per_cyc) + " ops/cycle/core ("
+                     + type_str + ") x live NPU clock")
+              << box("Press Ctrl+C to stop")
               << "╚══════════════════════════════════════════════════════════════╝\n"
               << std::endl;
 
+    if (csv)
+        *csv << "t_sec,core0_runs,core1_runs,core2_runs,interval_gops,"
+                "ops_per_cycle_per_core,mac_util_pct,"
+                "host_cpu_pct,host_cpu_ms_per_gop,"
+                "npu_temp_c,npu_freq_mhz,throttle_level,throttle_mask,"
+                "throttle_eta_sec,steady\n";
+
     uint64_t prev_runs[3] = {0, 0, 0};
+    uint64_t prev_ns = 0;
+    ThreadCpuSample prev_cpu[3];
     int sec = 0;
 
+    // interval 은 worker 와 같은 t0 에서 시작, 이후 t0 + k초 경계에 정렬 (drift 없음)
+    bench_clock::time_point mon_t0;
+    if (!barrier.wait(running, mon_t0)) return;
+    running_rss_kb->store(rss_kb());   // 모든 context 생성 + warm-up 완료 시점
+    auto prev_t = mon_t0;
+    std::cout << "Start barrier released, measuring from t0\n" << std::endl;
+
     while (running.load()) {
-        std::this_thread::sleep_for(std::chrono::seconds(1));
+        // 1초 동안 100 ms 마다 NPU clock 을 읽어 interval 평균 주파수 계산
+        double freq_sum = 0;
+        int    freq_n   = 0;
+        for (int s = 0; s < 10 && running.load(); s++) {
+            std::this_thread::sleep_until(mon_t0 + std::chrono::seconds(sec)
+                                          + std::chrono::milliseconds(100 * (s + 1)));
+            long f = sampler ? sampler->latest().npu_freq_hz : -1;
+            if (f > 0) {
+                freq_sum += f / 1e6;
+                freq_n++;
+            }
+        }
         sec++;
+        auto now = bench_clock::now();
+        double dt = elapsed_ns(prev_t, now) / 1e9;
+        prev_t = now;
+
+        const bool   live_clk = freq_n > 0;
+        const double mhz      = live_clk ? freq_sum / freq_n : nominal_mhz;
+        const double cycles   = mhz * 1e6 * dt;        // core 1개의 interval cycle 수
 
         double total_gops = 0;
+        uint64_t deltas[3];
+        ThreadCpuSample cpu_sum;
         std::cout << "── [" << sec << "s] ─────────────────────────────\n";
 
         for (int i = 0; i < 3; i++) {
             uint64_t runs = stats[i].total_runs.load();
             uint64_t delta = runs - prev_runs[i];
             prev_runs[i] = runs;
+            deltas[i] = delta;
 
-            double gops = stats[i].peak_gops.load();
+            ThreadCpuSample c = stats[i].cpu();
+            ThreadCpuSample dc = c - prev_cpu[i];
+            prev_cpu[i] = c;
+            cpu_sum += dc;
+
+            const double ops  = delta * (double)ops_per_run;
+            const double gops = ops / dt / 1e9;
+            const double opc  = ops / cycles;
             total_gops += gops;
-            double util = gops / theoretical_per_core * 100.0;
 
             std::cout << "  Core " << i
                       << ": " << std::setw(7) << std::fixed << std::setprecision(1)
                       << gops << " GOPS"
-                      << "  (" << std::setprecision(1) << util << "% efficiency)"
-                      << "  runs/s: " << delta << "\n";
+                      << "  " << std::setw(6) << opc << " ops/cyc"
+                      << " (" << std::setprecision(1) << opc / peak_ops_per_cyc * 100.0 << "% MAC util)"
+                      << "  runs/s: " << delta
+                      << "  host CPU " << std::setprecision(1) << dc.cpu_ns / (dt * 1e7) << "%"
+                      << "  csw/run " << std::setprecision(2)
+                      << (delta ? (double)(dc.nvcsw + dc.nivcsw) / delta : 0.0) << "\n";
         }
 
-        double total_util = total_gops / theoretical_total * 100.0;
+        const double total_opc = total_gops * 1e9 * dt / cycles / 3.0;
         std::cout << "  TOTAL : " << std::setw(7) << std::fixed << std::setprecision(1)
                   << total_gops << " GOPS"
-                  << "  (" << std::setprecision(1) << total_util << "% of "
-                  << theoretical_total << " GOPS theoretical)\n\n";
+                  << "  " << std::setw(6) << total_opc << " ops/cyc/core"
+                  << " (" << total_opc / peak_ops_per_cyc * 100.0 << "% MAC util @ "
+                  << std::setprecision(0) << mhz << " MHz" << (live_clk ? "" : " nominal") << ")\n";
+
+        // NPU를 구동하는 3개 thread가 쓴 host CPU (100% = core 1개)
+        const double interval_gop = (deltas[0] + deltas[1] + deltas[2]) * (double)ops_per_run / 1e9;
+        const double host_pct     = cpu_sum.cpu_ns / (dt * 1e7);
+        const double ms_per_gop   = interval_gop > 0 ? cpu_sum.cpu_ns / 1e6 / interval_gop : 0.0;
+        std::cout << "  HOST  : " << std::setprecision(1) << host_pct << "% CPU"
+                  << " (user " << cpu_sum.user_ns / (dt * 1e7)
+                  << "% / kernel " << cpu_sum.sys_ns / (dt * 1e7) << "%)"
+                  << "  " << std::setprecision(3) << ms_per_gop << " CPU-ms/GOP\n";
+
+        // 같은 interval의 thermal state를 붙여서 출력/기록
+        ThermalSnapshot th = sampler ? sampler->latest() : ThermalSnapshot{};
+        std::cout << "  NPU   : ";
+        if (th.has_temp()) std::cout << std::setprecision(1) << th.temp_c() << "°C";
+        else               std::cout << "N/A";
+        if (th.npu_freq_hz > 0) std::cout << " @ " << std::setprecision(0) << th.freq_mhz() << " MHz";
+        std::cout << "  throttle: " << (sampler ? sampler->throttle_str(th) : "N/A") << "\n";
+
+        // throttle 까지 남은 시간 예측 + steady state 감지
+        ThrottleForecast fc;
+        bool steady = false;
+        if (forecast && th.has_temp()) {
+            forecast->add(elapsed_ns(mon_t0, now) / 1e9, th.temp_c(), total_gops, th.throttled());
+            forecast->print_status(std::cout);
+            fc = forecast->forecast();
+            steady = forecast->steady();
+            if (stop_at_steady && steady) stop->set_reason("steady state");
+        }
+
+        // interval 평균 latency 를 CI batch 로
+        uint64_t ns_now = 0;
+        for (int i = 0; i < 3; i++) ns_now += stats[i].total_ns.load();
+        const uint64_t runs_iv = deltas[0] + deltas[1] + deltas[2];
+        if (runs_iv) stop->add_interval((double)(ns_now - prev_ns) / runs_iv);
+        prev_ns = ns_now;
+        if (stop->check(elapsed_ns(mon_t0, now) / 1e9)) {
+            std::cout << "  stop: " << stop->reason() << " (latency CI ±" << std::setprecision(2)
+                      << stop->ci_half_pct() << "%)\n";
+            running.store(false);
+        }
+        std::cout << "\n";
+
+        if (csv) {
+            double interval_gops = (deltas[0] + deltas[1] + deltas[2]) * (double)ops_per_run
+                                   / (dt > 0 ? dt : 1.0) / 1e9;
+            *csv << std::fixed << std::setprecision(3) << elapsed_ns(bench_t0(), now) / 1e9
+                 << "," << deltas[0] << "," << deltas[1] << "," << deltas[2]
+                 << "," << std::setprecision(1) << interval_gops
+                 << "," << total_opc << "," << total_opc / peak_ops_per_cyc * 100.0
+                 << "," << host_pct << "," << std::setprecision(4) << ms_per_gop
+                 << "," << std::setprecision(1);
+            if (th.has_temp()) *csv << th.temp_c();
+            *csv << "," << std::setprecision(0) << th.freq_mhz()
+                 << "," << th.throttle_level << "," << th.throttle_mask << ",";
+            if (fc.valid && fc.eta_sec >= 0) *csv << fc.eta_sec;
+            *csv << "," << steady << "\n";
+            csv->flush();
+        }
     }
 }
 
@@ -260,43 +440,268 @@ std::atomic<bool> g_running{true};
 
 void signal_handler(int) { g_running.store(false); }
 
-int main(int argc, char* argv[])
+// positional: M K N [type], 나머지는 --option value
+bool parse_args(int argc, char* argv[], BenchConfig& cfg)
 {
-    signal(SIGINT, signal_handler);
-
-    int M = 1024, K = 4096, N = 4096;
-    rknn_tensor_type type = RKNN_TENSOR_INT8;
+    std::vector<std::string> pos;
+    for (int i = 1; i < argc; i++) {
+        std::string a = argv[i];
+        auto next = [&]() -> std::string {
+            if (i + 1 >= argc) {
+                std::cerr << "Missing value for " << a << std::endl;
+                std::exit(1);
+            }
+            return argv[++i];
+        };
+        if      (a == "--mode")        cfg.mode         = next();
+        else if (a == "--sysfs-root")  cfg.sysfs.root   = next();
+        else if (a == "--sample-ms")   cfg.sample_ms    = std::atoi(next().c_str());
+        else if (a == "--csv")         cfg.csv_path     = next();
+        else if (a == "--run-log")     cfg.run_log_path = next();
+        else if (a == "--phase-sec")   cfg.phase_sec    = std::atoi(next().c_str());
+        else if (a == "--phases")      cfg.phases       = next();
+        else if (a == "--out")         cfg.out_dir      = next();
+        else if (a == "--cpu-cores")   cfg.cpu_load.cores     = parse_int_list(next());
+        else if (a == "--cpu-load")    cfg.cpu_load.load_a55  = cfg.cpu_load.load_a76
+                                                              = std::atoi(next().c_str());
+        else if (a == "--cpu-load-a55") cfg.cpu_load.load_a55 = std::atoi(next().c_str());
+        else if (a == "--cpu-load-a76") cfg.cpu_load.load_a76 = std::atoi(next().c_str());
+        else if (a == "--cpu-period-ms") cfg.cpu_load.period_ms = std::atoi(next().c_str());
+        else if (a == "--mem-threads") cfg.mem.threads = std::atoi(next().c_str());
+        else if (a == "--mem-mb")      cfg.mem.mb      = std::atoi(next().c_str());
+        else if (a == "--mem-kernel")  cfg.mem.kernel  = next();
+        else if (a == "--mem-cores")   cfg.mem.cores   = parse_int_list(next());
+        else if (a == "--classes")     cfg.classes     = next();
+        else if (a == "--lat-cpu")     cfg.lat_cpu     = std::atoi(next().c_str());
+        else if (a == "--worker-cpus") cfg.worker_cpus = parse_int_list(next());
+        else if (a == "--monitor-cpu") cfg.monitor_cpu = std::atoi(next().c_str());
+        else if (a == "--rt-prio")     cfg.rt_prio     = std::atoi(next().c_str());
+        else if (a == "--monitor-rt-prio") cfg.monitor_rt_prio = std::atoi(next().c_str());
+        else if (a == "--wake-gaps")   cfg.wake_gaps   = next();
+        else if (a == "--wake-types")  cfg.wake_types  = next();
+        else if (a == "--wake-reps")   cfg.wake_reps   = std::atoi(next().c_str());
+        else if (a == "--startup-k")   cfg.startup_k    = next();
+        else if (a == "--startup-n")   cfg.startup_n    = next();
+        else if (a == "--startup-reps") cfg.startup_reps = std::atoi(next().c_str());
+        else if (a == "--staged-init") cfg.staged_init  = true;
+        else if (a == "--shared-b")    cfg.shared_b     = true;
+        else if (a == "--maxshape-types") cfg.maxshape_types = next();
+        else if (a == "--maxshape-cores") cfg.maxshape_cores = next();
+        else if (a == "--maxshape-grow")  cfg.maxshape_grow  = next();
+        else if (a == "--maxshape-max")   cfg.maxshape_max   = std::atoi(next().c_str());
+        else if (a == "--maxshape-sec")   cfg.maxshape_sec   = std::atoi(next().c_str());
+        else if (a == "--pool-shapes")    cfg.pool_shapes    = next();
+        else if (a == "--pool-ops")       cfg.pool_ops       = std::atoi(next().c_str());
+        else if (a == "--pool-budget-mb") cfg.pool_budget_mb = std::atoi(next().c_str());
+        else if (a == "--pool-cores")     cfg.pool_cores     = std::atoi(next().c_str());
+        else if (a == "--dvfs-freqs")  cfg.dvfs_freqs  = next();
+        else if (a == "--dvfs-cpu-gov") cfg.dvfs_cpu_gov = next();
+        else if (a == "--dvfs-settle-ms") cfg.dvfs_settle_ms = std::atoi(next().c_str());
+        else if (a == "--data-patterns") cfg.data_patterns = next();
+        else if (a == "--data-apply")  cfg.data_apply  = next();
+        else if (a == "--data-cooldown-sec") cfg.data_cooldown_sec = std::atoi(next().c_str());
+        else if (a == "--gov-target-c") cfg.gov_target_c = std::atof(next().c_str());
+        else if (a == "--gov-kp")      cfg.gov_kp      = std::atof(next().c_str());
+        else if (a == "--gov-ki")      cfg.gov_ki      = std::atof(next().c_str());
+        else if (a == "--gov-kd")      cfg.gov_kd      = std::atof(next().c_str());
+        else if (a == "--gov-min-duty") cfg.gov_min_duty = std::atof(next().c_str());
+        else if (a == "--gov-period-ms") cfg.gov_period_ms = std::atoi(next().c_str());
+        else if (a == "--gov-cooldown-sec") cfg.gov_cooldown_sec = std::atoi(next().c_str());
+        else if (a == "--sim-profile") cfg.sim_profile = next();
+        else if (a == "--sim-params")  cfg.sim_params  = next();
+        else if (a == "--sim-speed")   cfg.sim_speed   = std::atof(next().c_str());
+        else if (a == "--trip-c")      cfg.trip_c        = std::atof(next().c_str());
+        else if (a == "--steady-window") cfg.steady_window = std::atoi(next().c_str());
+        else if (a == "--steady-ci")   cfg.steady_ci_pct = std::atof(next().c_str());
+        else if (a == "--steady-slope") cfg.steady_slope = std::atof(next().c_str());
+        else if (a == "--stop-at-steady") cfg.stop_at_steady = true;
+        else if (a == "--seed")        cfg.seed          = std::strtoull(next().c_str(), nullptr, 0);
+        else if (a == "--fp16-dist")   cfg.fp16_dist     = next();
+        else if (a == "--fp16-scale")  cfg.fp16_scale    = std::atof(next().c_str());
+        else if (a == "--duration")    cfg.duration_sec  = std::atoi(next().c_str());
+        else if (a == "--iterations")  cfg.iterations    = std::strtoull(next().c_str(), nullptr, 10);
+        else if (a == "--until-ci")    cfg.until_ci_pct  = std::atof(next().c_str());
+        else if (a == "--rt-probe-cpu")     cfg.rt_probe.cpu     = std::atoi(next().c_str());
+        else if (a == "--rt-probe-prio")    cfg.rt_probe.rt_prio = std::atoi(next().c_str());
+        else if (a == "--rt-probe-hz")      cfg.rt_probe.hz      = std::atoi(next().c_str());
+        else if (a == "--rt-probe-work-us") cfg.rt_probe.work_us = std::atoi(next().c_str());
+        else if (a.compare(0, 2, "--") == 0) {
+            std::cerr << "Unknown option: " << a << std::endl;
+            return false;
+        }
+        else pos.push_back(a);
+    }
 
-    if (argc >= 4) {
-        M = std::atoi(argv[1]);
-        K = std::atoi(argv[2]);
-        N = std::atoi(argv[3]);
+    if (pos.size() >= 3) {
+        cfg.M = std::atoi(pos[0].c_str());
+        cfg.K = std::atoi(pos[1].c_str());
+        cfg.N = std::atoi(pos[2].c_str());
+        cfg.shape_set = true;
     }
-    if (argc >= 5) {
-        int t = std::atoi(argv[4]);
-        type = (t == 1) ? RKNN_TENSOR_FLOAT16 : RKNN_TENSOR_INT8;
+    if (pos.size() >= 4) {
+        int t = std::atoi(pos[3].c_str());
+        cfg.type = (t == 1) ? RKNN_TENSOR_FLOAT16 : RKNN_TENSOR_INT8;
     }
+    return true;
+}
 
+int main(int argc, char* argv[])
+{
+    signal(SIGINT, signal_handler);
+    signal(SIGTERM, signal_handler);   // timeout / kill 로 끝나도 summary 출력
+    bench_t0();
+
+    BenchConfig cfg;
+    if (!parse_args(argc, argv, cfg)) return 1;
+    datagen::set_seed(cfg.seed);
+    if (!datagen::parse_fp16_dist(cfg.fp16_dist, datagen::params().fp16)) {
+        std::cerr << "Unknown --fp16-dist: " << cfg.fp16_dist << " (uniform|normal|weight|raw)" << std::endl;
+        return 1;
+    }
+    datagen::params().scale = (float)cfg.fp16_scale;
+    datagen::params().staged_init = cfg.staged_init;
+    if (cfg.mode == "sim") return run_thermal_sim(cfg, g_running);   // NPU 불필요
+
+    const int M = cfg.M, K = cfg.K, N = cfg.N;
+    const rknn_tensor_type type = cfg.type;
+
+    const uint64_t ops_per_run = (uint64_t)M * N * (2ULL * K - 1);
     std::cout << "Matrix: M=" << M << " K=" << K << " N=" << N << "\n";
     std::cout << "Ops/matmul: "
-              << (double)((uint64_t)M * N * (2ULL*K - 1)) / 1e9 << " GOPS\n";
+              << (double)ops_per_run / 1e9 << " GOPS\n";
+    std::cout << "Data seed: " << cfg.seed;
+    if (type == RKNN_TENSOR_FLOAT16)
+        std::cout << ", fp16 " << cfg.fp16_dist << " scale " << cfg.fp16_scale;
+    std::cout << "\n";
+
+    ThermalSampler sampler(cfg.sysfs, cfg.sample_ms);
+    sampler.print_config(std::cout);
+    sampler.start();
+
+    if (cfg.mode == "orchestrate") return run_orchestrator(cfg, sampler, g_running);
+    if (cfg.mode == "ddr")         return run_ddr_contention(cfg, sampler, g_running);
+    if (cfg.mode == "interference") return run_interference_matrix(cfg, sampler, g_running);
+    if (cfg.mode == "placement")   return run_placement_compare(cfg, sampler, g_running);
+    if (cfg.mode == "submit")      return run_submit_overhead(cfg, g_running);
+    if (cfg.mode == "wake")        return run_wake_sweep(cfg, sampler, g_running);
+    if (cfg.mode == "startup")     return run_startup_sweep(cfg, g_running);
+    if (cfg.mode == "init")        return run_init_compare(cfg, g_running);
+    if (cfg.mode == "shared-b")    return run_shared_b_compare(cfg, sampler, g_running);
+    if (cfg.mode == "maxshape")    return run_max_shape(cfg, g_running);
+    if (cfg.mode == "pool")        return run_pool_replay(cfg, g_running);
+    if (cfg.mode == "dvfs")        return run_dvfs_sweep(cfg, sampler, g_running);
+    if (cfg.mode == "data")        return run_data_sweep(cfg, sampler, g_running);
+    if (cfg.mode == "governor")    return run_thermal_governor(cfg, sampler, g_running);
+    if (cfg.mode != "stress") {
+        std::cerr << "Unknown mode: " << cfg.mode << std::endl;
+        return 1;
+    }
+
+    const std::string& csv_path = cfg.csv_path;
+    const std::string& run_log_path = cfg.run_log_path;
+    std::ofstream csv;
+    if (!csv_path.empty()) {
+        csv.open(csv_path);
+        if (!csv) std::cerr << "Cannot open " << csv_path << std::endl;
+    }
 
     CoreStats stats[3];
+    // --run-log: 실행 중 file 로 streaming (ring 크기로 memory 고정, run_log.h)
+    std::unique_ptr<RunLogWriter> run_log;
+    if (!run_log_path.empty()) {
+        run_log = std::make_unique<RunLogWriter>(run_log_path, 3, ops_per_run);
+        if (!run_log->ok()) std::cerr << "Cannot open " << run_log_path << std::endl;
+        run_log->start();
+    }
 
     // 3개 worker 스레드 (각각 NPU Core 0/1/2에 고정)
+    // --worker-cpus 가 있으면 host CPU 쪽도 thread별로 고정
+    const auto placements = worker_placements(cfg, !cfg.worker_cpus.empty(), cfg.rt_prio);
+    StartBarrier barrier(3);
+
+    // --shared-b: core 0 의 B 를 core 1, 2 가 bind → B owner 가 먼저 생기고 나중에 파괴되어야
+    // 하므로 context 는 main 에서 만들고 worker 에는 pointer 만 넘긴다
+    std::unique_ptr<RKNNMatMul> shared_mm[3];
+    if (cfg.shared_b) {
+        for (int i = 0; i < 3; i++) {
+            shared_mm[i] = std::make_unique<RKNNMatMul>(M, K, N, type, 1, 1, CORE_MASKS[i],
+                                                        i > 0 ? shared_mm[0].get() : nullptr);
+            if (i == 0 && !shared_mm[0]->valid) {
+                std::cerr << "Shared B: core 0 context (B owner) init failed" << std::endl;
+                sampler.stop();
+                return 1;
+            }
+        }
+        int bound = 0;
+        for (auto& mm : shared_mm) bound += mm->valid;
+        std::cout << "Shared B: " << shared_mm[0]->attr.B.size / 1048576.0 << " MB bound to " << bound
+                  << " contexts (saves " << (bound - 1) * (double)shared_mm[0]->attr.B.size / 1048576.0
+                  << " MB)\n";
+    }
+
     std::thread workers[3];
     for (int i = 0; i < 3; i++) {
         workers[i] = std::thread(stress_worker, i, M, K, N,
-                                 type, std::ref(g_running), std::ref(stats[i]));
+                                 type, std::ref(g_running), std::ref(stats[i]),
+                                 &sampler, run_log ? run_log->ring(i) : nullptr,
+                                 placements[i], cfg.iterations, std::ref(barrier),
+                                 shared_mm[i].get());
     }
 
-    std::thread mon(monitor_thread, std::ref(g_running), stats, type);
+    RtProbeWorkload probe(cfg.rt_probe);
+    if (cfg.rt_probe.cpu >= 0) probe.start(bench_clock::now());
+
+    const double trip_c = cfg.trip_c > 0 ? cfg.trip_c : npu_trip_c(cfg.sysfs, sampler.npu_zone());
+    ThermalForecaster forecast(trip_c, cfg.steady_window, cfg.steady_ci_pct, cfg.steady_slope);
+    StopCondition stop(cfg.duration_sec, cfg.until_ci_pct);
+
+    std::atomic<long> running_rss_kb{-1};
+    std::thread mon(monitor_thread, std::ref(g_running), stats, type, ops_per_run,
+                    &sampler, csv.is_open() ? &csv : nullptr,
+                    ThreadPlacement{cfg.monitor_cpu, cfg.monitor_rt_prio},
+                    sampler.npu_zone().empty() ? nullptr : &forecast, cfg.stop_at_steady, &stop,
+                    std::ref(barrier), &running_rss_kb);
 
+    // 종료 순서: worker → monitor → probe → sampler → 결과 출력
+    // worker 가 모두 끝났는데 running 이 살아 있으면 --iterations 도달 (또는 init 실패)
     for (auto& w : workers) w.join();
+    for (int i = 2; i >= 0; i--) shared_mm[i].reset();   // B owner (core 0) 마지막
+    const bool workers_done = g_running.exchange(false);
     mon.join();
+    if (workers_done) stop.set_reason(cfg.iterations ? "iterations " + std::to_string(cfg.iterations)
+                                                      : std::string("workers exited"));
+    probe.stop();
+    sampler.stop();
+
+    if (run_log) {
+        run_log->stop();
+        std::cout << "Run log: " << run_log_path << " (" << run_log->rows() << " rows";
+        if (run_log->dropped()) std::cout << ", " << run_log->dropped() << " dropped: writer fell behind";
+        std::cout << ")\n";
+    }
 
     // Final summary
     std::cout << "\n═══ Final Summary ═══\n";
+    stop.report(std::cout);
+
+    // barrier 이후 core 간 시작 skew (t0 대비 첫 run 시작)
+    int64_t off_min = INT64_MAX, off_max = INT64_MIN;
+    std::cout << "Start barrier:\n";
+    for (int i = 0; i < 3; i++) {
+        std::cout << "  Core " << i << ": ";
+        if (!stats[i].started.load()) {
+            std::cout << "not started\n";
+            continue;
+        }
+        const int64_t off = stats[i].start_offset_ns.load();
+        off_min = std::min(off_min, off);
+        off_max = std::max(off_max, off);
+        std::cout << "init " << std::fixed << std::setprecision(1) << stats[i].init_ns.load() / 1e6
+                  << " ms, warm-up " << stats[i].warmup_ns.load() / 1e6
+                  << " ms, first run t0+" << off / 1e3 << " us\n";
+    }
+    if (off_max >= off_min) std::cout << "  skew  : " << (off_max - off_min) / 1e3 << " us\n";
+    print_memory_footprint(std::cout, stats, 3, running_rss_kb.load());
     for (int i = 0; i < 3; i++) {
         uint64_t runs = stats[i].total_runs.load();
         uint64_t ns   = stats[i].total_ns.load();
@@ -307,5 +712,42 @@ int main(int argc, char* argv[])
                   << ", peak " << std::setprecision(1) << stats[i].peak_gops.load() << " GOPS\n";
     }
 
+    // Host CPU cost: worker thread가 run 시간 중 CPU를 얼마나 점유했는지
+    std::cout << "\nHost CPU (NPU worker threads, after warm-up):\n";
+    ThreadCpuSample cpu_total;
+    uint64_t runs_total = 0;
+    for (int i = 0; i < 3; i++) {
+        const ThreadCpuSample c = stats[i].cpu();
+        const uint64_t runs = stats[i].total_runs.load();
+        const uint64_t ns   = stats[i].total_ns.load();
+        const double   gop  = runs * (double)ops_per_run / 1e9;
+        cpu_total += c;
+        runs_total += runs;
+        std::cout << "Core " << i << ": " << std::fixed << std::setprecision(1)
+                  << c.cpu_ns / 1e6 << " ms CPU"
+                  << " (" << (ns ? c.cpu_ns * 100.0 / ns : 0.0) << "% of run time"
+                  << ", user " << c.user_ns / 1e6 << " / kernel " << c.sys_ns / 1e6 << " ms)"
+                  << ", csw/run " << std::setprecision(2)
+                  << (runs ? (double)(c.nvcsw + c.nivcsw) / runs : 0.0)
+                  << " (vol " << c.nvcsw << " / invol " << c.nivcsw << ")"
+                  << ", " << std::setprecision(3) << (gop > 0 ? c.cpu_ns / 1e6 / gop : 0.0)
+                  << " CPU-ms/GOP\n";
+    }
+    const double gop_total = runs_total * (double)ops_per_run / 1e9;
+    std::cout << "Total : " << std::setprecision(3)
+              << (gop_total > 0 ? cpu_total.cpu_ns / 1e6 / gop_total : 0.0) << " host CPU-ms per NPU-GOP, "
+              << std::setprecision(1) << (runs_total ? cpu_total.cpu_ns / 1e3 / runs_total : 0.0)
+              << " us CPU per run\n";
+
+    if (cfg.rt_probe.cpu >= 0) {
+        std::cout << "\nControl loop probe:\n";
+        probe.report(std::cout);
+    }
+
+    if (!sampler.npu_zone().empty()) {
+        std::cout << "\n";
+        forecast.report(std::cout);
+    }
+
     return 0;
-}
\ No newline at end of file
+}
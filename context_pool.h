@@ -0,0 +1,160 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <unordered_map>
+
+#include "bench_common.h"
+#include "npu_matmul.h"
+
+// ============================================================
+// Shape-keyed RKNNMatMul context pool (LRU)
+//
+// dynamic shape 서비스에서 call 마다 context 를 만들면
+// (create + create_mem × 3 + set_io_mem) 이 hot path 에 들어간다.
+// (M, K, N, type, layout, core) 별로 context 를 재사용하고, DMA byte 합이
+// budget 을 넘으면 가장 오래 안 쓴 것부터 파괴한다.
+//
+// worker thread 하나에서 쓰는 것을 전제 (lock 없음).
+// acquire() 가 돌려준 pointer 는 다음 acquire() / clear() 까지만 유효.
+// budget 보다 큰 context 도 만들어 주되 (다른 것을 모두 evict) 캐시에 하나만 남는다.
+// 생성 전에 evict 하므로 resident DMA 는 budget 이하 (처음 보는 key 는 shape 추정치 기준).
+// ============================================================
+struct ContextKey {
+    int m, k, n;
+    rknn_tensor_type type;
+    int native_layout = 1, perf_layout = 1;
+    int core = 0;                    // CORE_MASKS index
+
+    bool operator==(const ContextKey& o) const
+    {
+        return m == o.m && k == o.k && n == o.n && type == o.type && native_layout == o.native_layout
+            && perf_layout == o.perf_layout && core == o.core;
+    }
+};
+
+struct ContextKeyHash {
+    size_t operator()(const ContextKey& key) const
+    {
+        uint64_t h = 1469598103934665603ULL;     // FNV-1a
+        for (int v : {key.m, key.k, key.n, (int)key.type, key.native_layout, key.perf_layout, key.core}) {
+            h ^= (uint32_t)v;
+            h *= 1099511628211ULL;
+        }
+        return (size_t)h;
+    }
+};
+
+class ContextPool
+{
+public:
+    struct Stats {
+        uint64_t hits = 0, misses = 0, evictions = 0, failures = 0;
+        uint64_t create_ns = 0, evict_ns = 0;    // miss 시 생성 / eviction 파괴 누적
+        uint64_t peak_bytes = 0;
+    };
+
+    explicit ContextPool(uint64_t budget_bytes) : budget_(budget_bytes) {}
+    ~ContextPool() { clear(); }
+
+    ContextPool(const ContextPool&) = delete;
+    ContextPool& operator=(const ContextPool&) = delete;
+
+    // hit: LRU 맨 앞으로.
+    // miss: 먼저 budget 에 맞게 evict 한 뒤 생성 (resident DMA 가 budget 을 넘지 않도록).
+    //       생성 실패 (메모리 부족) 면 LRU 를 하나씩 evict 하며 pool 이 빌 때까지 재시도.
+    // 그래도 실패하면 nullptr
+    RKNNMatMul* acquire(const ContextKey& key)
+    {
+        auto it = index_.find(key);
+        if (it != index_.end()) {
+            stats_.hits++;
+            lru_.splice(lru_.begin(), lru_, it->second);
+            return it->second->mm.get();
+        }
+
+        stats_.misses++;
+        const uint64_t need = expected_bytes(key);
+        while (!lru_.empty() && bytes_ + need > budget_) evict_one();
+
+        std::unique_ptr<RKNNMatMul> mm;
+        for (;;) {
+            const auto t0 = bench_clock::now();
+            mm = std::make_unique<RKNNMatMul>(key.m, key.k, key.n, key.type, key.native_layout,
+                                              key.perf_layout, CORE_MASKS[key.core]);
+            stats_.create_ns += elapsed_ns(t0, bench_clock::now());
+            if (mm->valid) break;
+            if (lru_.empty()) {
+                stats_.failures++;
+                return nullptr;
+            }
+            mm.reset();
+            evict_one();
+        }
+
+        const uint64_t b = mm->dma_bytes();
+        sizes_[key] = b;
+        stats_.peak_bytes = std::max(stats_.peak_bytes, bytes_ + b);   // 추정이 작았으면 잠깐 초과
+        while (!lru_.empty() && bytes_ + b > budget_) evict_one();
+        lru_.push_front(Entry{key, std::move(mm), b});
+        index_[key] = lru_.begin();
+        bytes_ += b;
+        return lru_.front().mm.get();
+    }
+
+    // 전부 파괴 (eviction 통계에는 넣지 않음)
+    void clear()
+    {
+        index_.clear();
+        lru_.clear();
+        bytes_ = 0;
+    }
+
+    const Stats& stats() const { return stats_; }
+    uint64_t bytes()  const { return bytes_; }
+    uint64_t budget() const { return budget_; }
+    size_t   size()   const { return lru_.size(); }
+
+    double hit_rate() const
+    {
+        const uint64_t n = stats_.hits + stats_.misses;
+        return n ? (double)stats_.hits / n : 0.0;
+    }
+
+private:
+    struct Entry {
+        ContextKey key;
+        std::unique_ptr<RKNNMatMul> mm;
+        uint64_t bytes;
+    };
+
+    // 처음 보는 key 는 shape 로 추정 (A, B: elem byte, C: 4 byte), 이후는 실제 dma_bytes()
+    uint64_t expected_bytes(const ContextKey& key) const
+    {
+        auto it = sizes_.find(key);
+        if (it != sizes_.end()) return it->second;
+        const uint64_t eb = key.type == RKNN_TENSOR_FLOAT16 ? 2 : 1;
+        return ((uint64_t)key.m * key.k + (uint64_t)key.k * key.n) * eb + (uint64_t)key.m * key.n * 4;
+    }
+
+    void evict_one()
+    {
+        Entry& e = lru_.back();
+        const auto t0 = bench_clock::now();
+        e.mm.reset();
+        stats_.evict_ns += elapsed_ns(t0, bench_clock::now());
+        stats_.evictions++;
+        bytes_ -= e.bytes;
+        index_.erase(e.key);
+        lru_.pop_back();
+    }
+
+    uint64_t budget_;
+    uint64_t bytes_ = 0;
+    std::list<Entry> lru_;           // front = most recently used
+    std::unordered_map<ContextKey, std::list<Entry>::iterator, ContextKeyHash> index_;
+    std::unordered_map<ContextKey, uint64_t, ContextKeyHash> sizes_;   // key 별 dma_bytes (evict 후에도 유지)
+    Stats stats_;
+};
@@ -0,0 +1,209 @@
+#pragma once
+#include <cstdint>
+#include <iomanip>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+#include "bench_config.h"
+#include "sysfs.h"
+#include "thread_placement.h"
+#include "workload.h"
+
+// ============================================================
+// CPU load engine: stress-ng --cpu N --cpu-load X 대체
+//
+//   - worker 1개 = CPU core 1개 (pthread affinity 고정)
+//   - 부하는 실제 INT8 GEMM tile (NEON sdot / smull, 없으면 scalar)
+//   - PWM duty cycle: period 마다 on 구간은 GEMM, 나머지는 sleep
+//   - cluster별 목표 부하 (A55 / A76 따로)
+//   - worker별 GOPS 보고 → NPU 부하 시 CPU 쪽 성능 저하도 측정
+//
+// ops 정의는 NPU와 동일 (M*N*(2K-1)).
+// ============================================================
+constexpr int CPU_TILE = 64;
+
+// C[M][N] += A[M][K] * B^T[N][K]  (B는 transpose 저장 → inner loop 연속 접근)
+inline void cpu_gemm_tile_s8(const int8_t* a, const int8_t* bt, int32_t* c)
+{
+#if defined(__ARM_NEON)
+    for (int i = 0; i < CPU_TILE; i++) {
+        const int8_t* ar = a + i * CPU_TILE;
+        for (int j = 0; j < CPU_TILE; j += 4) {
+            int32x4_t acc[4] = {vdupq_n_s32(0), vdupq_n_s32(0), vdupq_n_s32(0), vdupq_n_s32(0)};
+            for (int p = 0; p < CPU_TILE; p += 16) {
+                int8x16_t va = vld1q_s8(ar + p);
+                for (int q = 0; q < 4; q++) {
+                    int8x16_t vb = vld1q_s8(bt + (j + q) * CPU_TILE + p);
+#if defined(__ARM_FEATURE_DOTPROD)
+                    acc[q] = vdotq_s32(acc[q], va, vb);
+#else
+                    acc[q] = vpadalq_s16(acc[q], vmull_s8(vget_low_s8(va), vget_low_s8(vb)));
+                    acc[q] = vpadalq_s16(acc[q], vmull_high_s8(va, vb));
+#endif
+                }
+            }
+            for (int q = 0; q < 4; q++)
+                c[i * CPU_TILE + j + q] += vaddvq_s32(acc[q]);
+        }
+    }
+#else
+    for (int i = 0; i < CPU_TILE; i++) {
+        for (int j = 0; j < CPU_TILE; j++) {
+            int32_t acc = 0;
+            for (int p = 0; p < CPU_TILE; p++)
+                acc += (int32_t)a[i * CPU_TILE + p] * (int32_t)bt[j * CPU_TILE + p];
+            c[i * CPU_TILE + j] += acc;
+        }
+    }
+#endif
+}
+
+inline const char* cpu_gemm_kernel_name()
+{
+#if defined(__ARM_FEATURE_DOTPROD)
+    return "neon-sdot";
+#elif defined(__ARM_NEON)
+    return "neon-smull";
+#else
+    return "scalar";
+#endif
+}
+
+// cpu_capacity < 1024 → little (A55). sysfs에 없으면 RK3588 배치 (0-3 = A55) 가정.
+inline bool is_little_core(const Sysfs& fs, int cpu)
+{
+    long long cap = fs.read_ll("/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/cpu_capacity");
+    if (cap > 0) return cap < 1024;
+    return cpu < 4;
+}
+
+class CpuLoadWorkload : public Workload
+{
+public:
+    CpuLoadWorkload(const Sysfs& fs, const CpuLoadConfig& cfg)
+        : period_ms_(cfg.period_ms > 0 ? cfg.period_ms : 100)
+    {
+        for (int cpu : cfg.cores) {
+            Worker w;
+            w.cpu    = cpu;
+            w.little = is_little_core(fs, cpu);
+            w.duty   = (w.little ? cfg.load_a55 : cfg.load_a76) / 100.0;
+            if (w.duty <= 0) continue;
+            if (w.duty > 1) w.duty = 1;
+            workers_.push_back(w);
+        }
+        ops_    = std::vector<PaddedCounter>(workers_.size());
+        busy_   = std::vector<PaddedCounter>(workers_.size());
+    }
+
+    ~CpuLoadWorkload() override { stop(); }
+
+    std::string name() const override { return "cpu_gemm"; }
+    const char* unit() const override { return "GOPS"; }
+
+    void start(bench_clock::time_point t0) override
+    {
+        stop();
+        for (auto& o : ops_)  o.v.store(0);
+        for (auto& b : busy_) b.v.store(0);
+        t_start_ = t0;
+        running_.store(true);
+        for (size_t i = 0; i < workers_.size(); i++)
+            threads_.emplace_back([this, i, t0] { worker(i, t0); });
+    }
+
+    void stop() override
+    {
+        if (running_.load()) t_stop_ = bench_clock::now();
+        stop_threads();
+    }
+
+    double total() const override
+    {
+        uint64_t ops = 0;
+        for (auto& o : ops_) ops += o.v.load(std::memory_order_relaxed);
+        return ops / 1e9;
+    }
+
+    // worker별: wall 기준 GOPS, on 구간 기준 GOPS, 실제 duty
+    void report(std::ostream& os) const override
+    {
+        const double wall = elapsed_ns(t_start_, t_stop_) / 1e9;
+        if (wall <= 0) return;
+        os << "  CPU load (" << cpu_gemm_kernel_name() << ", PWM " << period_ms_ << " ms):\n";
+        std::map<std::string, std::pair<double, double>> cluster;   // name → (ops, busy_s)
+        for (size_t i = 0; i < workers_.size(); i++) {
+            const auto& w = workers_[i];
+            double ops  = (double)ops_[i].v.load();
+            double busy = busy_[i].v.load() / 1e9;
+            os << "    cpu" << w.cpu << (w.little ? " A55" : " A76") << std::fixed
+               << "  target " << std::setw(3) << (int)(w.duty * 100 + 0.5) << "%"
+               << "  actual " << std::setw(5) << std::setprecision(1) << busy / wall * 100.0 << "%"
+               << "  " << std::setw(7) << std::setprecision(2) << ops / wall / 1e9 << " GOPS"
+               << "  (" << std::setprecision(2) << (busy > 0 ? ops / busy / 1e9 : 0.0)
+               << " GOPS while on)\n";
+            auto& c = cluster[w.little ? "A55" : "A76"];
+            c.first += ops;
+            c.second += busy;
+        }
+        for (auto& kv : cluster)
+            os << "    " << kv.first << " total: " << std::setprecision(2)
+               << kv.second.first / wall / 1e9 << " GOPS ("
+               << (kv.second.second > 0 ? kv.second.first / kv.second.second / 1e9 : 0.0)
+               << " GOPS/core while on)\n";
+    }
+
+    size_t num_workers() const { return workers_.size(); }
+
+private:
+    struct Worker {
+        int    cpu;
+        bool   little;
+        double duty;
+    };
+
+    void worker(size_t i, bench_clock::time_point t0)
+    {
+        const Worker w = workers_[i];
+        apply_placement({w.cpu, 0}, "cpu_gemm");
+
+        std::vector<int8_t>  a(CPU_TILE * CPU_TILE), bt(CPU_TILE * CPU_TILE);
+        std::vector<int32_t> c(CPU_TILE * CPU_TILE, 0);
+        for (int x = 0; x < CPU_TILE * CPU_TILE; x++) {
+            a[x]  = (int8_t)(x * 7 + w.cpu);
+            bt[x] = (int8_t)(x * 13 - w.cpu);
+        }
+        const uint64_t ops_per_tile = (uint64_t)CPU_TILE * CPU_TILE * (2 * CPU_TILE - 1);
+        const auto period = std::chrono::nanoseconds((int64_t)period_ms_ * 1000000);
+        const auto on     = std::chrono::nanoseconds((int64_t)(period.count() * w.duty));
+
+        std::this_thread::sleep_until(t0);
+        for (auto p_start = t0; running_.load(std::memory_order_relaxed); p_start += period) {
+            // on 구간: GEMM tile 반복
+            const auto on_end = p_start + on;
+            auto t = bench_clock::now();
+            const auto busy_start = t;
+            while (t < on_end && running_.load(std::memory_order_relaxed)) {
+                cpu_gemm_tile_s8(a.data(), bt.data(), c.data());
+                ops_[i].v.fetch_add(ops_per_tile, std::memory_order_relaxed);
+                t = bench_clock::now();
+            }
+            busy_[i].v.fetch_add(elapsed_ns(busy_start, t), std::memory_order_relaxed);
+
+            // off 구간
+            if (w.duty < 1.0) std::this_thread::sleep_until(p_start + period);
+        }
+        sink_.fetch_add(c[0], std::memory_order_relaxed);  // 결과를 사용해 DCE 방지
+    }
+
+    int period_ms_;
+    std::vector<Worker> workers_;
+    std::vector<PaddedCounter> ops_, busy_;
+    bench_clock::time_point t_start_{}, t_stop_{};
+    std::atomic<int64_t> sink_{0};
+};
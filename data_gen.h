@@ -0,0 +1,395 @@
+#pragma once
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#elif defined(__F16C__)
+#include <immintrin.h>
+#endif
+
+// ============================================================
+// Counter-based 난수 생성 (Philox4x32-10, Salmon et al. SC'11)
+//
+// 원소 i 의 값은 (seed, stream, i) 만으로 결정된다:
+//   counter = {block lo, block hi, stream lo, stream hi}, key = seed
+//   block   = i / (원소 수 per 16 byte)
+// 그래서 thread 수 / 분할과 무관하게 bit-exact 재현, thread 간 동기화 없음.
+// mt19937 + random_device 를 매 호출 만들고 1개씩 뽑던 fill_random 대체.
+// 8 block 씩 SoA 로 돌려 compiler auto-vectorize (NEON umull) 되도록 작성.
+// ============================================================
+namespace datagen {
+
+constexpr size_t PHILOX_LANES = 8;
+
+// 8 block 을 한 번에 (out[w][lane] = block lane 의 word w)
+inline void philox4x32_10(uint64_t block0, uint64_t stream, uint64_t seed,
+                          uint32_t out[4][PHILOX_LANES])
+{
+    constexpr uint32_t M0 = 0xD2511F53u, M1 = 0xCD9E8D57u;
+    constexpr uint32_t W0 = 0x9E3779B9u, W1 = 0xBB67AE85u;
+    uint32_t c0[PHILOX_LANES], c1[PHILOX_LANES], c2[PHILOX_LANES], c3[PHILOX_LANES];
+    for (size_t l = 0; l < PHILOX_LANES; l++) {
+        const uint64_t b = block0 + l;
+        c0[l] = (uint32_t)b;
+        c1[l] = (uint32_t)(b >> 32);
+        c2[l] = (uint32_t)stream;
+        c3[l] = (uint32_t)(stream >> 32);
+    }
+    uint32_t k0 = (uint32_t)seed, k1 = (uint32_t)(seed >> 32);
+    for (int r = 0; r < 10; r++) {
+        for (size_t l = 0; l < PHILOX_LANES; l++) {
+            const uint64_t p0 = (uint64_t)M0 * c0[l];
+            const uint64_t p1 = (uint64_t)M1 * c2[l];
+            const uint32_t n0 = (uint32_t)(p1 >> 32) ^ c1[l] ^ k0;
+            const uint32_t n2 = (uint32_t)(p0 >> 32) ^ c3[l] ^ k1;
+            c1[l] = (uint32_t)p1;
+            c3[l] = (uint32_t)p0;
+            c0[l] = n0;
+            c2[l] = n2;
+        }
+        k0 += W0;
+        k1 += W1;
+    }
+    for (size_t l = 0; l < PHILOX_LANES; l++) {
+        out[0][l] = c0[l]; out[1][l] = c1[l]; out[2][l] = c2[l]; out[3][l] = c3[l];
+    }
+}
+
+// [first, last) block 마다 emit(block, words[4])
+template <typename Emit>
+inline void for_each_block(uint64_t first, uint64_t last, uint64_t stream, uint64_t seed, Emit emit)
+{
+    uint32_t out[4][PHILOX_LANES];
+    for (uint64_t b = first; b < last; b += PHILOX_LANES) {
+        philox4x32_10(b, stream, seed, out);
+        const uint64_t nb = std::min<uint64_t>(PHILOX_LANES, last - b);
+        for (uint64_t l = 0; l < nb; l++) {
+            const uint32_t w[4] = {out[0][l], out[1][l], out[2][l], out[3][l]};
+            emit(b + l, w);
+        }
+    }
+}
+
+// block 범위를 thread 에 나눠 실행 (작은 tensor 는 호출 thread 에서)
+template <typename Fn>
+inline void parallel_blocks(uint64_t blocks, Fn fn)
+{
+    constexpr uint64_t MIN_BLOCKS_PER_THREAD = 1 << 15;    // 512 KB
+    const unsigned hw = std::max(1u, std::thread::hardware_concurrency());
+    const uint64_t nt = std::min<uint64_t>(hw, std::max<uint64_t>(1, blocks / MIN_BLOCKS_PER_THREAD));
+    if (nt <= 1) {
+        fn(0, blocks);
+        return;
+    }
+    std::vector<std::thread> th;
+    const uint64_t per = (blocks + nt - 1) / nt;
+    for (uint64_t t = 0; t < nt; t++) {
+        const uint64_t a = t * per, b = std::min(blocks, a + per);
+        if (a < b) th.emplace_back(fn, a, b);
+    }
+    for (auto& t : th) t.join();
+}
+
+// raw random bits (block 당 16 byte)
+inline void fill_bits(void* dst, size_t bytes, uint64_t seed, uint64_t stream)
+{
+    uint8_t* p = static_cast<uint8_t*>(dst);
+    const uint64_t blocks = (bytes + 15) / 16;
+    parallel_blocks(blocks, [=](uint64_t first, uint64_t last) {
+        for_each_block(first, last, stream, seed, [=](uint64_t b, const uint32_t* w) {
+            const size_t off = b * 16;
+            std::memcpy(p + off, w, std::min<size_t>(16, bytes - off));
+        });
+    });
+}
+
+// 정수 [lo, hi] 균등. 전체 범위면 raw bits, 아니면 원소당 32bit word 1개 (Lemire 곱셈 mapping)
+template <typename T>
+inline void fill_uniform(T* dst, size_t count, T lo, T hi, uint64_t seed, uint64_t stream)
+{
+    static_assert(std::is_integral<T>::value && sizeof(T) <= 4, "8/16/32-bit integers only");
+    const uint64_t span = (uint64_t)((int64_t)hi - (int64_t)lo) + 1;
+    if (span == (1ull << (8 * sizeof(T)))) {
+        fill_bits(dst, count * sizeof(T), seed, stream);
+        return;
+    }
+    const uint64_t blocks = (count + 3) / 4;
+    parallel_blocks(blocks, [=](uint64_t first, uint64_t last) {
+        for_each_block(first, last, stream, seed, [=](uint64_t b, const uint32_t* w) {
+            const size_t i0 = b * 4, n = std::min<size_t>(4, count - i0);
+            for (size_t j = 0; j < n; j++)
+                dst[i0 + j] = (T)((int64_t)lo + (int64_t)(((uint64_t)w[j] * span) >> 32));
+        });
+    });
+}
+
+// ============================================================
+// FP16 입력: fp32 로 분포에서 뽑은 뒤 IEEE half 로 변환
+//   uniform : U(-scale, scale)
+//   normal  : N(0, scale)                       (Box-Muller)
+//   weight  : A = N(0, scale) activation,
+//             B = Laplace, std scale/sqrt(K)    (학습된 weight 처럼 0 근처 집중 + 긴 꼬리)
+//   raw     : 16bit 무작위 pattern (NaN/Inf/denormal 포함, 예전 동작)
+// ============================================================
+enum class Fp16Dist { Uniform, Normal, Weight, Raw };
+
+inline bool parse_fp16_dist(const std::string& s, Fp16Dist& out)
+{
+    if      (s == "uniform") out = Fp16Dist::Uniform;
+    else if (s == "normal")  out = Fp16Dist::Normal;
+    else if (s == "weight")  out = Fp16Dist::Weight;
+    else if (s == "raw")     out = Fp16Dist::Raw;
+    else return false;
+    return true;
+}
+
+inline const char* fp16_dist_name(Fp16Dist d)
+{
+    switch (d) {
+    case Fp16Dist::Uniform: return "uniform";
+    case Fp16Dist::Normal:  return "normal";
+    case Fp16Dist::Weight:  return "weight";
+    default:                return "raw";
+    }
+}
+
+// ============================================================
+// Data pattern (tensor 별): switching activity 가 data 에 따라 달라지므로
+//   random      : 기본 (INT8 전체 범위 / FP16 --fp16-dist)
+//   zeros       : 전부 0
+//   const:X     : 모든 원소 X (INT8 은 반올림 clamp, FP16 은 half(X))
+//   sparse:P    : random 뒤 P% 원소를 0 으로 (원소별 Bernoulli)
+//   file:PATH   : PATH 의 raw byte (int8 / fp16 little-endian) 를 반복해서 채움
+// ============================================================
+struct DataPattern {
+    enum Kind { Random, Zeros, Const, Sparse, File } kind = Random;
+    double      value = 0;     // const 값 / sparse 0 비율 (%)
+    std::string path;
+    std::string label = "random";
+};
+
+inline bool parse_data_pattern(const std::string& s, DataPattern& out)
+{
+    const size_t c = s.find(':');
+    const std::string name = s.substr(0, c), arg = c == std::string::npos ? "" : s.substr(c + 1);
+    DataPattern p;
+    p.label = s;
+    if      (name == "random" || name == "uniform") p.kind = DataPattern::Random;
+    else if (name == "zeros")                       p.kind = DataPattern::Zeros;
+    else if (name == "const" && !arg.empty())     { p.kind = DataPattern::Const;  p.value = std::atof(arg.c_str()); }
+    else if (name == "sparse" && !arg.empty())    { p.kind = DataPattern::Sparse; p.value = std::atof(arg.c_str()); }
+    else if (name == "file" && !arg.empty())      { p.kind = DataPattern::File;   p.path = arg; }
+    else return false;
+    out = p;
+    return true;
+}
+
+// 프로세스 공통 입력 데이터 설정 (--seed, --fp16-dist, --fp16-scale, data mode pattern).
+// RKNNMatMul 은 (seed, core, tensor) 로 stream 을 고른다.
+struct DataParams {
+    uint64_t    seed  = 1;
+    Fp16Dist    fp16  = Fp16Dist::Uniform;
+    float       scale = 1.0f;
+    DataPattern pattern_a, pattern_b;
+    bool        staged_init = false; // RKNNMatMul: host buffer 경유 (비교용, npu_matmul.h)
+};
+inline DataParams& params()
+{
+    static DataParams p;
+    return p;
+}
+inline void     set_seed(uint64_t s) { params().seed = s; }
+inline uint64_t seed()               { return params().seed; }
+
+// fp32 → fp16 bit, round-to-nearest-even (F. Giesen float_to_half_fast3_rtne)
+// subnormal 은 float 덧셈으로 rounding, overflow → Inf, NaN → quiet NaN
+inline uint16_t float_to_half(float f)
+{
+    constexpr uint32_t F32_INF = 255u << 23, F16_MAX = (127u + 16) << 23;
+    constexpr uint32_t DENORM_MAGIC = ((127u - 15) + (23 - 10) + 1) << 23;
+    uint32_t x;
+    std::memcpy(&x, &f, 4);
+    const uint32_t sign = x & 0x80000000u;
+    x ^= sign;
+    uint16_t o;
+    if (x >= F16_MAX) {
+        o = x > F32_INF ? 0x7E00 : 0x7C00;
+    } else if (x < (113u << 23)) {
+        float fx, magic;
+        std::memcpy(&fx, &x, 4);
+        std::memcpy(&magic, &DENORM_MAGIC, 4);
+        fx += magic;
+        std::memcpy(&x, &fx, 4);
+        o = (uint16_t)(x - DENORM_MAGIC);
+    } else {
+        const uint32_t mant_odd = (x >> 13) & 1;
+        x += ((15u - 127u) << 23) + 0xFFFu + mant_odd;
+        o = (uint16_t)(x >> 13);
+    }
+    return (uint16_t)(o | (sign >> 16));
+}
+
+// 4개씩 변환: NEON vcvt / x86 F16C, 없으면 scalar
+inline void float_to_half4(const float* in, uint16_t* out)
+{
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+    vst1_u16(out, vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(in))));
+#elif defined(__F16C__)
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(out),
+                     _mm_cvtps_ph(_mm_loadu_ps(in), _MM_FROUND_TO_NEAREST_INT));
+#else
+    for (int i = 0; i < 4; i++) out[i] = float_to_half(in[i]);
+#endif
+}
+
+// 32bit word → (0, 1) 개구간. 상위 23bit + 0.5 는 float 로 정확히 표현되므로
+// 최댓값 (2^23 - 0.5) / 2^23 < 1 (24bit 로 하면 2^24 - 0.5 가 2^24 로 반올림 → 1.0)
+inline float unit_open(uint32_t w) { return ((w >> 9) + 0.5f) * (1.0f / 8388608.0f); }
+
+// fill_fp16 의 sample 변환 (data_gen_test.cpp 에서 w 전 범위 검사)
+// uniform: 16bit → ±s
+inline float uniform_sample(uint32_t u16, float s)
+{
+    return ((u16 + 0.5f) * (2.0f / 65536.0f) - 1.0f) * s;
+}
+
+// Laplace(0, b): inverse CDF. log 인자는 FLT_MIN 이상 → ±Inf 없음
+inline float laplace_sample(uint32_t w, float b)
+{
+    const float u = unit_open(w) - 0.5f;
+    return (u < 0 ? b : -b) * std::log(std::max(FLT_MIN, 1.0f - 2.0f * std::fabs(u)));
+}
+
+// Box-Muller: word 2개 → N(0, s²) 값 2개
+inline void normal_pair(uint32_t w0, uint32_t w1, float s, float& x, float& y)
+{
+    const float r = s * std::sqrt(-2.0f * std::log(std::max(FLT_MIN, unit_open(w0))));
+    const float t = 6.2831853f * unit_open(w1);
+    x = r * std::cos(t);
+    y = r * std::sin(t);
+}
+
+// tensor 'A' (M×K activation) / 'B' (K×N weight) 를 params().fp16 분포로 채움
+inline void fill_fp16(uint16_t* dst, size_t count, char tensor, int k, uint64_t seed, uint64_t stream)
+{
+    const DataParams p = params();
+    if (p.fp16 == Fp16Dist::Raw) {
+        fill_bits(dst, count * 2, seed, stream);
+        return;
+    }
+    const float s = p.scale;
+    const bool laplace = p.fp16 == Fp16Dist::Weight && tensor == 'B';
+    const float b = s / std::sqrt(2.0f * std::max(1, k));   // Laplace std = √2·b = s/√K
+
+    // uniform: half 는 mantissa 11bit 라 값당 16bit 면 충분 → block 당 8개
+    if (p.fp16 == Fp16Dist::Uniform) {
+        const uint64_t blocks = (count + 7) / 8;
+        parallel_blocks(blocks, [=](uint64_t first, uint64_t last) {
+            for_each_block(first, last, stream, seed, [=](uint64_t blk, const uint32_t* w) {
+                float f[8];
+                for (int j = 0; j < 8; j++)
+                    f[j] = uniform_sample((w[j / 2] >> (16 * (j & 1))) & 0xFFFFu, s);
+                const size_t i0 = blk * 8;
+                if (i0 + 8 <= count) {
+                    float_to_half4(f, dst + i0);
+                    float_to_half4(f + 4, dst + i0 + 4);
+                } else {
+                    for (size_t j = 0; i0 + j < count; j++) dst[i0 + j] = float_to_half(f[j]);
+                }
+            });
+        });
+        return;
+    }
+
+    const uint64_t blocks = (count + 3) / 4;
+    parallel_blocks(blocks, [=](uint64_t first, uint64_t last) {
+        for_each_block(first, last, stream, seed, [=](uint64_t blk, const uint32_t* w) {
+            float f[4];
+            if (laplace) {
+                for (int j = 0; j < 4; j++) f[j] = laplace_sample(w[j], b);
+            } else {
+                for (int j = 0; j < 4; j += 2) normal_pair(w[j], w[j + 1], s, f[j], f[j + 1]);
+            }
+            const size_t i0 = blk * 4;
+            if (i0 + 4 <= count) {
+                float_to_half4(f, dst + i0);
+            } else {
+                for (size_t j = 0; i0 + j < count; j++) dst[i0 + j] = float_to_half(f[j]);
+            }
+        });
+    });
+}
+
+// tensor 별 stream id: 같은 seed 라도 context (core mask) / A·B 마다 다른 데이터
+inline uint64_t tensor_stream(uint32_t ctx_id, char tensor)
+{
+    return ((uint64_t)ctx_id << 8) | (uint8_t)tensor;
+}
+
+// count 개 원소 (elem_bytes 크기) 중 frac 비율을 0 으로. stream 은 값 생성과 분리
+inline void zero_fraction(void* dst, size_t count, size_t elem_bytes, double frac,
+                          uint64_t seed, uint64_t stream)
+{
+    uint8_t* p = static_cast<uint8_t*>(dst);
+    const uint64_t thr = (uint64_t)(std::min(1.0, std::max(0.0, frac)) * 4294967296.0);
+    const uint64_t blocks = (count + 3) / 4;
+    parallel_blocks(blocks, [=](uint64_t first, uint64_t last) {
+        for_each_block(first, last, stream ^ (0x5A17ull << 48), seed, [=](uint64_t b, const uint32_t* w) {
+            const size_t i0 = b * 4, n = std::min<size_t>(4, count - i0);
+            for (size_t j = 0; j < n; j++)
+                if (w[j] < thr) std::memset(p + (i0 + j) * elem_bytes, 0, elem_bytes);
+        });
+    });
+}
+
+// tensor 'A' / 'B' 하나를 params() 의 pattern 으로 채움 (RKNNMatMul 공용)
+inline void fill_tensor(void* dst, size_t count, bool fp16, char tensor, int k,
+                        uint64_t seed, uint64_t stream)
+{
+    const DataPattern pat = tensor == 'A' ? params().pattern_a : params().pattern_b;
+    const size_t eb = fp16 ? 2 : 1;
+    switch (pat.kind) {
+    case DataPattern::Zeros:
+        std::memset(dst, 0, count * eb);
+        return;
+    case DataPattern::Const:
+        if (fp16) std::fill_n(static_cast<uint16_t*>(dst), count, float_to_half((float)pat.value));
+        else      std::memset(dst, (int8_t)std::lround(std::min(127.0, std::max(-128.0, pat.value))), count);
+        return;
+    case DataPattern::File: {
+        // raw byte 복사. layout 변환 없음 → native_layout B 에는 tile 순서로 들어간다
+        std::ifstream f(pat.path, std::ios::binary);
+        std::vector<char> buf((std::istreambuf_iterator<char>(f)), std::istreambuf_iterator<char>());
+        buf.resize(buf.size() / eb * eb);
+        if (buf.empty()) {
+            std::cerr << "data file " << pat.path << " unreadable or empty, using zeros" << std::endl;
+            std::memset(dst, 0, count * eb);
+            return;
+        }
+        char* p = static_cast<char*>(dst);
+        for (size_t off = 0, total = count * eb; off < total; off += buf.size())
+            std::memcpy(p + off, buf.data(), std::min(buf.size(), total - off));
+        return;
+    }
+    default:
+        break;
+    }
+    if (fp16) fill_fp16(static_cast<uint16_t*>(dst), count, tensor, k, seed, stream);
+    else      fill_uniform(static_cast<int8_t*>(dst), count, (int8_t)-128, (int8_t)127, seed, stream);
+    if (pat.kind == DataPattern::Sparse) zero_fraction(dst, count, eb, pat.value / 100.0, seed, stream);
+}
+
+} // namespace datagen
@@ -0,0 +1,150 @@
+#pragma once
+#include <atomic>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "bench_config.h"
+#include "data_gen.h"
+#include "npu_workload.h"
+#include "power_meter.h"
+#include "thermal_sampler.h"
+
+// ============================================================
+// Data mode: 입력 data pattern 별 GOPS / power / 온도
+//
+// MAC 의 switching activity 는 data 에 따라 달라진다 (0 이 많거나
+// entropy 가 낮으면 전력이 덜 든다). pattern 마다 context 를 새로 만들어
+// (cooldown →) phase-sec 동안 3-core 실행, dvfs mode 와 같은 지표:
+//   GOPS, 평균 W, GOPS/W, 온도 mean / max / slope
+// --data-apply 로 pattern 을 A, B, 또는 둘 다에 적용 (나머지는 random).
+// ============================================================
+struct DataPoint {
+    std::string label;
+    double gops = 0, power_w = -1;
+    double temp_mean = 0, temp_max = 0, slope = 0;
+};
+
+inline int run_data_sweep(const BenchConfig& cfg, ThermalSampler& sampler,
+                          std::atomic<bool>& running)
+{
+    std::vector<datagen::DataPattern> pats;
+    for (auto& name : parse_name_list(cfg.data_patterns)) {
+        datagen::DataPattern p;
+        if (!datagen::parse_data_pattern(name, p)) {
+            std::cerr << "Unknown data pattern: " << name
+                      << " (random | zeros | const:X | sparse:PCT | file:PATH)" << std::endl;
+            return 1;
+        }
+        if (p.kind == datagen::DataPattern::File && !std::ifstream(p.path, std::ios::binary)) {
+            std::cerr << "Cannot open data file: " << p.path << std::endl;
+            return 1;
+        }
+        // byte 를 그대로 복사 → B (native_layout=1) 는 native tile 순서로 해석됨 (README)
+        if (p.kind == datagen::DataPattern::File && cfg.data_apply != "a")
+            std::cout << "note: " << p.label << " is copied raw; B uses the native layout, so a normal-layout "
+                         "weight file is scrambled into tile order (value histogram kept)\n";
+        pats.push_back(p);
+    }
+    if (cfg.data_apply != "a" && cfg.data_apply != "b" && cfg.data_apply != "ab") {
+        std::cerr << "Unknown --data-apply: " << cfg.data_apply << " (a | b | ab)" << std::endl;
+        return 1;
+    }
+    const bool to_a = cfg.data_apply != "b";
+    const bool to_b = cfg.data_apply != "a";
+
+    PowerMeter power(cfg.sysfs);
+    std::cout << "Data sweep: " << cfg.M << "x" << cfg.K << "x" << cfg.N << " " << type_name(cfg.type)
+              << ", patterns on " << (to_a ? "A" : "") << (to_b ? "B" : "") << ", " << cfg.phase_sec
+              << " s each, cooldown " << cfg.data_cooldown_sec << " s\n"
+              << "  power   : " << power.source() << "\n";
+
+    std::ofstream csv;
+    if (!cfg.csv_path.empty()) {
+        csv.open(cfg.csv_path);
+        csv << std::fixed
+            << "pattern,apply,gops,power_w,gops_per_w,temp_mean_c,temp_max_c,temp_slope_c_per_min\n";
+    }
+
+    const datagen::DataParams saved = datagen::params();
+    std::vector<DataPoint> pts;
+    for (size_t i = 0; i < pats.size() && running.load(); i++) {
+        datagen::params().pattern_a = to_a ? pats[i] : datagen::DataPattern{};
+        datagen::params().pattern_b = to_b ? pats[i] : datagen::DataPattern{};
+
+        if (i > 0 && cfg.data_cooldown_sec > 0) {
+            std::cout << "\nCooldown " << cfg.data_cooldown_sec << "s..." << std::endl;
+            for (int s = 0; s < cfg.data_cooldown_sec && running.load(); s++)
+                std::this_thread::sleep_for(std::chrono::seconds(1));
+        }
+
+        std::cout << "\n▶ " << pats[i].label << std::endl;
+        NpuWorkload npu("npu", cfg.M, cfg.K, cfg.N, cfg.type);
+        if (!npu.prepare()) return 1;
+
+        const auto t0 = bench_clock::now() + std::chrono::milliseconds(200);
+        npu.start(t0);
+        std::this_thread::sleep_until(t0);
+
+        PowerThermalWindow win;
+        const auto t_end = t0 + std::chrono::seconds(cfg.phase_sec);
+        auto t = t0;
+        while (t < t_end && running.load()) {
+            t += std::chrono::milliseconds(cfg.sample_ms);
+            std::this_thread::sleep_until(t);
+            win.add(elapsed_ns(t0, t) / 1e9, power.read_w(), sampler.latest());
+        }
+        const double sec = elapsed_ns(t0, std::min(t, t_end)) / 1e9;
+        const double gop = npu.total();
+        npu.stop();
+
+        DataPoint pt;
+        pt.label     = pats[i].label;
+        pt.gops      = sec > 0 ? gop / sec : 0.0;
+        pt.power_w   = win.power_w();
+        pt.temp_mean = win.temp_mean();
+        pt.temp_max  = win.temp_max;
+        pt.slope     = win.slope_c_per_min();
+        pts.push_back(pt);
+
+        std::cout << std::fixed << std::setprecision(1) << "  " << pt.gops << " GOPS";
+        if (pt.power_w >= 0) std::cout << "  " << std::setprecision(2) << pt.power_w << " W";
+        std::cout << "  NPU " << std::setprecision(1) << pt.temp_mean << "°C, "
+                  << std::setprecision(2) << pt.slope << "°C/min" << std::endl;
+    }
+    datagen::params() = saved;
+
+    std::cout << "\n═══ Data Pattern Summary (" << cfg.M << "x" << cfg.K << "x" << cfg.N << " "
+              << type_name(cfg.type) << ", on " << (to_a ? "A" : "") << (to_b ? "B" : "") << ") ═══\n"
+              << std::left << std::setw(22) << "pattern" << std::right << std::setw(10) << "GOPS"
+              << std::setw(9) << "W" << std::setw(10) << "GOPS/W" << std::setw(9) << "vs 1st"
+              << std::setw(9) << "T mean" << std::setw(8) << "T max" << std::setw(11) << "°C/min" << "\n";
+    for (auto& p : pts) {
+        const double gpw = p.power_w > 0 ? p.gops / p.power_w : 0.0;
+        std::cout << std::left << std::setw(22) << p.label << std::right << std::fixed
+                  << std::setw(10) << std::setprecision(1) << p.gops;
+        if (p.power_w >= 0) {
+            std::cout << std::setw(9) << std::setprecision(2) << p.power_w
+                      << std::setw(10) << std::setprecision(1) << gpw;
+            if (pts[0].power_w > 0)
+                std::cout << std::setw(8) << std::showpos << (p.power_w / pts[0].power_w - 1.0) * 100.0
+                          << std::noshowpos << "%";
+            else
+                std::cout << std::setw(9) << "";
+        } else {
+            std::cout << std::setw(9) << "N/A" << std::setw(10) << "N/A" << std::setw(9) << "";
+        }
+        std::cout << std::setw(9) << std::setprecision(1) << p.temp_mean << std::setw(8) << p.temp_max
+                  << std::setw(11) << std::setprecision(2) << p.slope << "\n";
+        if (csv) {
+            csv << p.label << "," << cfg.data_apply << "," << std::setprecision(2) << p.gops << ",";
+            if (p.power_w >= 0) csv << p.power_w;
+            csv << "," << gpw << "," << p.temp_mean << "," << p.temp_max << "," << p.slope << "\n";
+        }
+    }
+    std::cout << "(vs 1st = power relative to the first pattern)\n";
+    return 0;
+}
@@ -0,0 +1,171 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "bench_config.h"
+#include "npu_workload.h"
+#include "power_meter.h"
+#include "sysfs.h"
+#include "thermal_sampler.h"
+
+// ============================================================
+// DVFS mode: NPU OPP 별 GOPS / power / 온도
+//
+// NPU devfreq 의 min_freq = max_freq = OPP 로 고정 (governor 무관)
+// → settle 후 phase-sec 동안 3-core NpuWorkload 실행.
+//   GOPS, ops/cycle/core, 평균 W, GOPS/W, 온도 mean/max/slope
+// --dvfs-cpu-gov 를 주면 cpufreq policy governor 도 같이 고정.
+// 변경한 sysfs 값은 SysfsRestore 가 종료 시 (Ctrl+C 포함) 복원.
+// ============================================================
+struct DvfsPoint {
+    long long set_hz = 0;
+    double    cur_mhz = 0;       // 측정 중 실제 cur_freq (median)
+    double    gops = 0;
+    double    power_w = -1;
+    double    temp_mean = 0, temp_max = 0, slope = 0;
+    bool      pinned = false;
+};
+
+inline std::vector<long long> npu_opps(const BenchConfig& cfg, const std::string& devfreq)
+{
+    std::vector<long long> f;
+    if (!cfg.dvfs_freqs.empty()) {
+        for (int mhz : parse_int_list(cfg.dvfs_freqs)) f.push_back((long long)mhz * 1000000);
+        return f;
+    }
+    std::string s;
+    if (cfg.sysfs.read_string(devfreq + "/available_frequencies", s)) {
+        std::stringstream ss(s);
+        long long v;
+        while (ss >> v) f.push_back(v);
+    }
+    std::sort(f.begin(), f.end());
+    return f;
+}
+
+inline int run_dvfs_sweep(const BenchConfig& cfg, ThermalSampler& sampler,
+                          std::atomic<bool>& running)
+{
+    const std::string df = sampler.npu_devfreq();
+    if (df.empty()) {
+        std::cerr << "NPU devfreq not found under " << cfg.sysfs.path("/sys/class/devfreq/") << std::endl;
+        return 1;
+    }
+    const std::vector<long long> opps = npu_opps(cfg, df);
+    if (opps.empty()) {
+        std::cerr << "No OPPs (" << df << "/available_frequencies, or --dvfs-freqs)" << std::endl;
+        return 1;
+    }
+
+    PowerMeter power(cfg.sysfs);
+    std::cout << "DVFS sweep: " << opps.size() << " OPPs, settle " << cfg.dvfs_settle_ms
+              << " ms, measure " << cfg.phase_sec << " s\n"
+              << "  devfreq : " << df << "\n"
+              << "  power   : " << power.source() << "\n";
+
+    NpuWorkload npu("npu", cfg.M, cfg.K, cfg.N, cfg.type);
+    std::cout << "Preparing NPU contexts..." << std::endl;
+    if (!npu.prepare()) return 1;
+
+    SysfsRestore restore(cfg.sysfs);
+    if (!cfg.dvfs_cpu_gov.empty()) {
+        const std::string cf = "/sys/devices/system/cpu/cpufreq/";
+        for (auto& p : cfg.sysfs.list_dir(cf, "policy")) {
+            if (!restore.set(cf + p + "/scaling_governor", cfg.dvfs_cpu_gov))
+                std::cerr << "  cannot set " << p << " governor to " << cfg.dvfs_cpu_gov << std::endl;
+        }
+    }
+
+    std::ofstream csv;
+    if (!cfg.csv_path.empty()) {
+        csv.open(cfg.csv_path);
+        csv << "set_mhz,cur_mhz,gops,ops_per_cycle_per_core,power_w,gops_per_w,"
+               "temp_mean_c,temp_max_c,temp_slope_c_per_min,pinned\n";
+    }
+
+    std::vector<DvfsPoint> pts;
+    for (long long hz : opps) {
+        if (!running.load()) break;
+        DvfsPoint pt;
+        pt.set_hz = hz;
+        // min 을 최저 OPP로 내린 뒤 max → min 순서 (min > max 거부 회피)
+        const std::string v = std::to_string(hz);
+        pt.pinned = restore.set(df + "/min_freq", std::to_string(opps.front())) &&
+                    restore.set(df + "/max_freq", v) &&
+                    restore.set(df + "/min_freq", v);
+        std::cout << "\n▶ OPP " << hz / 1000000 << " MHz" << (pt.pinned ? "" : "  (pin failed)")
+                  << std::endl;
+        std::this_thread::sleep_for(std::chrono::milliseconds(cfg.dvfs_settle_ms));
+
+        const auto t0 = bench_clock::now() + std::chrono::milliseconds(200);
+        npu.start(t0);
+        std::this_thread::sleep_until(t0);
+
+        PowerThermalWindow win;
+        std::vector<double> freqs;
+        const auto t_end = t0 + std::chrono::seconds(cfg.phase_sec);
+        auto t = t0;
+        while (t < t_end && running.load()) {
+            t += std::chrono::milliseconds(cfg.sample_ms);
+            std::this_thread::sleep_until(t);
+            ThermalSnapshot th = sampler.latest();
+            win.add(elapsed_ns(t0, t) / 1e9, power.read_w(), th);
+            if (th.npu_freq_hz > 0) freqs.push_back(th.freq_mhz());
+        }
+        const double sec = elapsed_ns(t0, std::min(t, t_end)) / 1e9;
+        const double gop = npu.total();
+        npu.stop();
+
+        std::sort(freqs.begin(), freqs.end());
+        pt.cur_mhz   = freqs.empty() ? 0.0 : freqs[freqs.size() / 2];
+        pt.gops      = sec > 0 ? gop / sec : 0.0;
+        pt.power_w   = win.power_w();
+        pt.temp_mean = win.temp_mean();
+        pt.temp_max  = win.temp_max;
+        pt.slope     = win.slope_c_per_min();
+        pts.push_back(pt);
+
+        std::cout << std::fixed << std::setprecision(1) << "  " << pt.gops << " GOPS @ "
+                  << std::setprecision(0) << pt.cur_mhz << " MHz";
+        if (pt.power_w >= 0) std::cout << "  " << std::setprecision(2) << pt.power_w << " W";
+        std::cout << "  NPU " << std::setprecision(1) << pt.temp_mean << "°C" << std::endl;
+    }
+    restore.restore();
+    std::cout << "\nRestored original devfreq / governor settings.\n";
+
+    std::cout << "\n═══ DVFS Sweep Summary (" << cfg.M << "x" << cfg.K << "x" << cfg.N << " "
+              << type_name(cfg.type) << ") ═══\n"
+              << std::setw(8) << "set MHz" << std::setw(9) << "cur MHz" << std::setw(10) << "GOPS"
+              << std::setw(14) << "ops/cyc/core" << std::setw(9) << "W" << std::setw(10) << "GOPS/W"
+              << std::setw(9) << "T mean" << std::setw(8) << "T max" << std::setw(11) << "°C/min" << "\n";
+    for (auto& p : pts) {
+        // 실제 cur_freq 기준 (읽을 수 없으면 설정값)
+        const double mhz = p.cur_mhz > 0 ? p.cur_mhz : p.set_hz / 1e6;
+        const double opc = p.gops * 1e3 / mhz / 3.0;
+        const double gpw = p.power_w > 0 ? p.gops / p.power_w : 0.0;
+        std::cout << std::fixed << std::setw(8) << p.set_hz / 1000000
+                  << std::setw(9) << std::setprecision(0) << p.cur_mhz
+                  << std::setw(10) << std::setprecision(1) << p.gops
+                  << std::setw(14) << std::setprecision(1) << opc;
+        if (p.power_w >= 0) std::cout << std::setw(9) << std::setprecision(2) << p.power_w
+                                      << std::setw(10) << std::setprecision(1) << gpw;
+        else                std::cout << std::setw(9) << "N/A" << std::setw(10) << "N/A";
+        std::cout << std::setw(9) << std::setprecision(1) << p.temp_mean
+                  << std::setw(8) << p.temp_max
+                  << std::setw(11) << std::setprecision(2) << p.slope
+                  << (p.pinned ? "" : "  (not pinned)") << "\n";
+        if (csv) csv << std::fixed << p.set_hz / 1000000 << "," << std::setprecision(0) << p.cur_mhz
+                     << "," << std::setprecision(2) << p.gops << "," << opc << ",";
+        if (csv && p.power_w >= 0) csv << p.power_w;
+        if (csv) csv << "," << gpw << "," << p.temp_mean << "," << p.temp_max
+                     << "," << p.slope << "," << p.pinned << "\n";
+    }
+    return 0;
+}
@@ -0,0 +1,149 @@
+#!/usr/bin/env python3
+"""
+RK3588 RC thermal model fitter
+- thermal_logger.sh 의 thermal_log.csv 에서 bench --mode sim 파라미터 추출
+
+Model (node 별, npu / soc):
+    dT/dt = (T_inf - T) / tau
+    T_inf = k0 + k_npu * u_npu + k_cpu * u_cpu
+  u_npu = npu_core*_pct 평균 / 100
+  u_cpu = cpu*_util_pct 평균 / 100 × (cpu freq / max freq)  (throttle 반영)
+dT/dt 를 [1, u_npu, u_cpu, T] 에 대해 최소자승 → tau, k0, k_npu, k_cpu.
+trip_c / hyst_c 는 cooling cur_state 가 0→>0 / >0→0 이 된 순간의 NPU 온도.
+
+Usage: python3 fit_thermal_model.py rk3588_stress_*/thermal_log.csv [-o thermal_model.params]
+       ./bench --mode sim --sysfs-root /tmp/fake_rk3588 --sim-params thermal_model.params
+"""
+import argparse
+import re
+import numpy as np
+import pandas as pd
+
+NODE_COLS = {
+    'npu': 'temp_npu_thermal_C',
+    'soc': 'temp_soc_thermal_C',
+}
+
+# =============================================================================
+# Data Loading
+# =============================================================================
+def load_log(path: str) -> pd.DataFrame:
+    df = pd.read_csv(path, comment='#')
+    for c in df.columns:
+        if c != 'timestamp':
+            df[c] = pd.to_numeric(df[c], errors='coerce')
+
+    npu_cols = [c for c in df.columns if re.match(r'^npu_core\d_pct$', c)]
+    util_cols = [c for c in df.columns if re.match(r'^cpu\d_util_pct$', c)]
+    freq_cols = [c for c in df.columns if re.match(r'^cpu\d_freq_mhz$', c)]
+
+    df['u_npu'] = df[npu_cols].mean(axis=1).fillna(0) / 100.0 if npu_cols else 0.0
+    u_cpu = df[util_cols].mean(axis=1).fillna(0) / 100.0 if util_cols else 0.0
+    if freq_cols:
+        f = df[freq_cols]
+        f_rel = (f / f.max()).mean(axis=1).fillna(1.0)
+        u_cpu = u_cpu * f_rel
+    df['u_cpu'] = u_cpu
+
+    cool_cols = [c for c in df.columns if re.match(r'^cool\d+_.+_cur$', c)]
+    df['throttle'] = (df[cool_cols].fillna(0) > 0).any(axis=1) if cool_cols else False
+    return df
+
+# =============================================================================
+# Fit
+# =============================================================================
+def fit_node(dfs: list[pd.DataFrame], col: str, smooth: int) -> dict | None:
+    rows, rhs = [], []
+    for df in dfs:
+        if col not in df.columns:
+            continue
+        t = df['elapsed_sec'].to_numpy(dtype=float)
+        T = df[col].rolling(smooth, center=True, min_periods=1).mean().to_numpy()
+        dt = np.diff(t)
+        ok = (dt > 0) & np.isfinite(T[:-1]) & np.isfinite(T[1:])
+        dTdt = (T[1:] - T[:-1])[ok] / dt[ok]
+        X = np.column_stack([np.ones(ok.sum()),
+                             df['u_npu'].to_numpy()[:-1][ok],
+                             df['u_cpu'].to_numpy()[:-1][ok],
+                             T[:-1][ok]])
+        rows.append(X)
+        rhs.append(dTdt)
+    if not rows:
+        return None
+
+    X, y = np.vstack(rows), np.concatenate(rhs)
+    c, *_ = np.linalg.lstsq(X, y, rcond=None)
+    if c[3] >= 0:
+        print(f'  [{col}] unstable fit (no cooling term), need longer heat-up/cool-down')
+        return None
+    tau = -1.0 / c[3]
+    return {'k0': c[0] * tau, 'k_npu': c[1] * tau, 'k_cpu': c[2] * tau, 'tau': tau}
+
+
+def simulate(df: pd.DataFrame, p: dict, col: str) -> np.ndarray:
+    """open-loop: 같은 u 로 model 을 돌려 실측 T 와 비교"""
+    t = df['elapsed_sec'].to_numpy(dtype=float)
+    T = np.empty(len(df))
+    T[0] = df[col].iloc[0]
+    for i in range(1, len(df)):
+        dt = max(t[i] - t[i - 1], 0.0)
+        t_inf = p['k0'] + p['k_npu'] * df['u_npu'].iloc[i - 1] + p['k_cpu'] * df['u_cpu'].iloc[i - 1]
+        T[i] = T[i - 1] + (t_inf - T[i - 1]) * min(1.0, dt / p['tau'])
+    return T
+
+
+def fit_trip(dfs: list[pd.DataFrame]) -> tuple[float | None, float | None]:
+    on, off = [], []
+    for df in dfs:
+        if NODE_COLS['npu'] not in df.columns:
+            continue
+        thr = df['throttle'].astype(int).diff().fillna(0)
+        on += df.loc[thr > 0, NODE_COLS['npu']].dropna().tolist()
+        off += df.loc[thr < 0, NODE_COLS['npu']].dropna().tolist()
+    trip = float(np.median(on)) if on else None
+    hyst = float(trip - np.median(off)) if trip is not None and off else None
+    return trip, hyst
+
+# =============================================================================
+# Main
+# =============================================================================
+def main():
+    ap = argparse.ArgumentParser(description='Fit RC thermal model from thermal_log.csv')
+    ap.add_argument('csv', nargs='+', help='thermal_logger.sh output(s)')
+    ap.add_argument('-o', '--output', default='thermal_model.params')
+    ap.add_argument('--smooth', type=int, default=5, help='rolling mean window (samples)')
+    args = ap.parse_args()
+
+    dfs = [load_log(p) for p in args.csv]
+    params = {}
+    print(f'Fitting {len(dfs)} log(s), {sum(len(d) for d in dfs)} samples')
+
+    for node, col in NODE_COLS.items():
+        p = fit_node(dfs, col, args.smooth)
+        if p is None:
+            print(f'  {node}: skipped ({col} missing or unstable)')
+            continue
+        err = np.concatenate([simulate(d, p, col) - d[col].to_numpy() for d in dfs if col in d])
+        rmse = float(np.sqrt(np.nanmean(err ** 2)))
+        print(f'  {node}: tau {p["tau"]:.1f}s  k0 {p["k0"]:.1f}  k_npu {p["k_npu"]:.1f}'
+              f'  k_cpu {p["k_cpu"]:.1f} °C   (open-loop RMSE {rmse:.2f} °C)')
+        for k, v in p.items():
+            params[f'{node}_{k}'] = v
+
+    trip, hyst = fit_trip(dfs)
+    if trip is not None:
+        params['trip_c'] = trip
+        print(f'  trip: {trip:.1f} °C')
+    if hyst is not None and hyst > 0:
+        params['hyst_c'] = hyst
+        print(f'  hyst: {hyst:.1f} °C')
+
+    with open(args.output, 'w') as f:
+        f.write(f'# fitted from {", ".join(args.csv)}\n')
+        for k, v in params.items():
+            f.write(f'{k}={v:.4f}\n')
+    print(f'Saved: {args.output}')
+
+
+if __name__ == '__main__':
+    main()
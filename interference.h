@@ -0,0 +1,191 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "bench_config.h"
+#include "cpu_load.h"
+#include "mem_bw.h"
+#include "npu_workload.h"
+#include "phase_runner.h"
+
+// ============================================================
+// Interference matrix mode
+//
+// workload class:
+//   npu_int8    : M x K x N INT8 (big GEMM, compute-bound)
+//   npu_gemv    : 1 x K x N INT8 (GEMV, memory-bound)
+//   npu_fp16    : M x K x N FP16
+//   cpu_compute : CpuLoadWorkload 100% duty (lat_cpu 제외 core)
+//   cpu_mem     : MemBwWorkload (STREAM triad)
+//   cpu_latency : lat_cpu 에 고정된 pointer-chase loop
+//
+// 각 class 단독 실행 후 모든 pair 를 phase-sec 동안 같이 실행.
+// slowdown[i][j] = rate_i(alone) / rate_i(with j)   (1.00 = 영향 없음)
+// ============================================================
+
+// DRAM latency에 민감한 loop: 랜덤 순환 permutation을 따라가는
+// dependent load 256개 = iteration 1회. rate = iterations/s.
+class LatencyLoopWorkload : public Workload
+{
+public:
+    LatencyLoopWorkload(int cpu, int mb = 64)
+        : cpu_(cpu), next_((size_t)mb * 1024 * 1024 / sizeof(uint32_t))
+    {
+        // Sattolo: 단일 cycle permutation → prefetcher가 따라올 수 없음
+        std::iota(next_.begin(), next_.end(), 0u);
+        std::mt19937 gen(12345);
+        for (size_t i = next_.size() - 1; i > 0; i--) {
+            std::uniform_int_distribution<size_t> d(0, i - 1);
+            std::swap(next_[i], next_[d(gen)]);
+        }
+    }
+
+    ~LatencyLoopWorkload() override { stop(); }
+
+    std::string name() const override { return "cpu_latency"; }
+    const char* unit() const override { return "kIter/s"; }
+
+    void start(bench_clock::time_point t0) override
+    {
+        stop();
+        iters_.v.store(0);
+        max_ns_.store(0);
+        running_.store(true);
+        threads_.emplace_back([this, t0] {
+            pin_thread_to_cpu(cpu_);
+            uint32_t p = 0;
+            std::this_thread::sleep_until(t0);
+            while (running_.load(std::memory_order_relaxed)) {
+                auto a = bench_clock::now();
+                for (int i = 0; i < 256; i++) p = next_[p];
+                uint64_t ns = elapsed_ns(a, bench_clock::now());
+                if (ns > max_ns_.load(std::memory_order_relaxed))
+                    max_ns_.store(ns, std::memory_order_relaxed);
+                iters_.v.fetch_add(1, std::memory_order_relaxed);
+            }
+            sink_.store(p);
+        });
+    }
+
+    double total() const override { return iters_.v.load(std::memory_order_relaxed) / 1e3; }
+
+    void report(std::ostream& os) const override
+    {
+        os << "  cpu_latency (cpu" << cpu_ << "): max iteration "
+           << std::fixed << std::setprecision(1) << max_ns_.load() / 1e3 << " us\n";
+    }
+
+private:
+    int cpu_;
+    std::vector<uint32_t> next_;
+    PaddedCounter iters_;
+    std::atomic<uint64_t> max_ns_{0};
+    std::atomic<uint32_t> sink_{0};
+};
+
+inline int run_interference_matrix(const BenchConfig& cfg, ThermalSampler& sampler,
+                                   std::atomic<bool>& running)
+{
+    // cpu_compute 는 latency probe core를 비워둔다 (같은 core 시분할 측정 방지)
+    CpuLoadConfig cc = cfg.cpu_load;
+    cc.load_a55 = cc.load_a76 = 100;
+    cc.cores.erase(std::remove(cc.cores.begin(), cc.cores.end(), cfg.lat_cpu), cc.cores.end());
+
+    const std::vector<std::string> names = parse_name_list(cfg.classes);
+    std::vector<std::unique_ptr<Workload>> all;
+    for (const auto& cls : names) {
+        if      (cls == "npu_int8")    all.emplace_back(new NpuWorkload(cls, cfg.M, cfg.K, cfg.N, RKNN_TENSOR_INT8));
+        else if (cls == "npu_gemv")    all.emplace_back(new NpuWorkload(cls, 1, cfg.K, cfg.N, RKNN_TENSOR_INT8));
+        else if (cls == "npu_fp16")    all.emplace_back(new NpuWorkload(cls, cfg.M, cfg.K, cfg.N, RKNN_TENSOR_FLOAT16));
+        else if (cls == "cpu_compute") all.emplace_back(new CpuLoadWorkload(cfg.sysfs, cc));
+        else if (cls == "cpu_mem")     all.emplace_back(new MemBwWorkload(cfg.mem));
+        else if (cls == "cpu_latency") all.emplace_back(new LatencyLoopWorkload(cfg.lat_cpu));
+        else {
+            std::cerr << "Unknown workload class: " << cls << std::endl;
+            return 1;
+        }
+    }
+    const size_t n = all.size();
+
+    std::cout << "Preparing " << n << " workload classes..." << std::endl;
+    std::vector<Workload*> cols;
+    for (auto& w : all) {
+        if (!w->prepare()) return 1;
+        cols.push_back(w.get());
+    }
+
+    std::ofstream timeline;
+    if (!cfg.out_dir.empty()) {
+        make_dirs(cfg.out_dir);
+        timeline.open(cfg.out_dir + "/timeline.csv");
+    }
+    PhaseRunner runner(sampler, running, cols, timeline.is_open() ? &timeline : nullptr);
+
+    // alone
+    std::vector<double> alone(n, 0.0);
+    for (size_t i = 0; i < n && running.load(); i++)
+        alone[i] = runner.run(names[i], {cols[i]}, cfg.phase_sec).rate[i];
+
+    // pairs. pair 에서 일을 못 했으면 inf (완전 정지), 측정 못 한 칸 (alone 도 0, Ctrl+C) 은 NaN → N/A
+    auto slowdown = [](double alone_rate, double pair_rate) -> double {
+        if (!(alone_rate > 0)) return NAN;
+        return pair_rate > 0 ? alone_rate / pair_rate : INFINITY;
+    };
+    auto cell = [](double v, int prec = 2) -> std::string {
+        if (std::isnan(v)) return "N/A";
+        if (std::isinf(v)) return "inf";
+        std::ostringstream os;
+        os << std::fixed << std::setprecision(prec) << v;
+        return os.str();
+    };
+    std::vector<std::vector<double>> slow(n, std::vector<double>(n, NAN));
+    for (size_t i = 0; i < n && running.load(); i++) {
+        for (size_t j = i + 1; j < n && running.load(); j++) {
+            PhaseResult r = runner.run(names[i] + "+" + names[j],
+                                       {cols[i], cols[j]}, cfg.phase_sec);
+            slow[i][j] = slowdown(alone[i], r.rate[i]);
+            slow[j][i] = slowdown(alone[j], r.rate[j]);
+        }
+    }
+
+    std::ofstream mcsv;
+    if (!cfg.out_dir.empty()) mcsv.open(cfg.out_dir + "/matrix.csv");
+
+    std::cout << "\n═══ Interference Matrix ═══\n"
+              << "slowdown = rate(alone) / rate(with column workload), phase "
+              << cfg.phase_sec << "s\n\n"
+              << std::left << std::setw(14) << "victim \\ with" << std::right;
+    if (mcsv) mcsv << "victim,alone_rate,unit";
+    for (auto& c : names) {
+        std::cout << std::setw(13) << c;
+        if (mcsv) mcsv << "," << c;
+    }
+    std::cout << std::setw(14) << "alone" << "\n";
+    if (mcsv) mcsv << "\n";
+
+    for (size_t i = 0; i < n; i++) {
+        std::cout << std::left << std::setw(14) << names[i] << std::right << std::fixed;
+        if (mcsv) mcsv << names[i] << "," << alone[i] << "," << cols[i]->unit();
+        for (size_t j = 0; j < n; j++) {
+            if (i == j)                      std::cout << std::setw(13) << "-";
+            else if (std::isnan(slow[i][j])) std::cout << std::setw(13) << "N/A";
+            else                             std::cout << std::setw(12) << cell(slow[i][j]) << "x";
+            if (mcsv) mcsv << "," << (i == j ? std::string("1") : cell(slow[i][j], 4));
+        }
+        std::cout << std::setw(10) << std::setprecision(1) << alone[i] << " " << cols[i]->unit() << "\n";
+        if (mcsv) mcsv << "\n";
+    }
+    std::cout << "(inf = victim completed no work in the pair phase, N/A = not measured)\n";
+    if (!cfg.out_dir.empty()) std::cout << "\nResults saved to: " << cfg.out_dir << "/\n";
+    return 0;
+}
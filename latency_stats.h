@@ -0,0 +1,114 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iomanip>
+#include <ostream>
+#include <vector>
+
+// ============================================================
+// Latency histogram (log-linear, ns 단위)
+//
+// 2의 거듭제곱 구간마다 32개 sub-bucket → 상대 오차 ~3%.
+// min/max/mean/stdev 는 정확값, percentile 은 bucket 대표값.
+// thread마다 하나씩 두고 끝난 뒤 merge() 한다 (lock 없음).
+// ============================================================
+class LatencyHistogram
+{
+public:
+    static constexpr int SUB_BITS = 5;
+    static constexpr int SUB      = 1 << SUB_BITS;
+    static constexpr int MAX_EXP  = 44;                 // ~4.8 h
+    static constexpr int BUCKETS  = (MAX_EXP - SUB_BITS + 2) * SUB;
+
+    LatencyHistogram() : counts_(BUCKETS, 0) {}
+
+    void add(uint64_t ns)
+    {
+        counts_[index(ns)]++;
+        n_++;
+        sum_   += (double)ns;
+        sumsq_ += (double)ns * (double)ns;
+        min_ = std::min(min_, ns);
+        max_ = std::max(max_, ns);
+    }
+
+    void merge(const LatencyHistogram& o)
+    {
+        for (size_t i = 0; i < counts_.size(); i++) counts_[i] += o.counts_[i];
+        n_ += o.n_;
+        sum_ += o.sum_;
+        sumsq_ += o.sumsq_;
+        min_ = std::min(min_, o.min_);
+        max_ = std::max(max_, o.max_);
+    }
+
+    void reset() { *this = LatencyHistogram(); }
+
+    uint64_t count() const { return n_; }
+    uint64_t min()   const { return n_ ? min_ : 0; }
+    uint64_t max()   const { return max_; }
+    double   mean()  const { return n_ ? sum_ / n_ : 0.0; }
+    double   stdev() const
+    {
+        if (n_ < 2) return 0.0;
+        double m = mean();
+        return std::sqrt(std::max(0.0, sumsq_ / n_ - m * m));
+    }
+
+    // p: 0~100
+    uint64_t percentile(double p) const
+    {
+        if (n_ == 0) return 0;
+        uint64_t target = (uint64_t)std::ceil(p / 100.0 * n_);
+        if (target == 0) target = 1;
+        uint64_t acc = 0;
+        for (size_t i = 0; i < counts_.size(); i++) {
+            acc += counts_[i];
+            if (acc >= target) return std::min(std::max(value(i), min_), max_);
+        }
+        return max_;
+    }
+
+    // 비어있지 않은 bucket 의 (하한값, count) — 분포 출력용
+    template <typename F>
+    void for_each_bucket(F f) const
+    {
+        for (size_t i = 0; i < counts_.size(); i++)
+            if (counts_[i]) f(value(i), counts_[i]);
+    }
+
+    // "mean 1.23 sd 0.10 p50 1.20 p99 1.50 p99.9 1.80 max 2.00 (ms)"
+    void print(std::ostream& os, double scale = 1e6, const char* unit = "ms") const
+    {
+        os << std::fixed << std::setprecision(3)
+           << "mean " << mean() / scale << "  sd " << stdev() / scale
+           << "  p50 " << percentile(50) / scale << "  p99 " << percentile(99) / scale
+           << "  p99.9 " << percentile(99.9) / scale << "  max " << max() / scale
+           << " " << unit;
+    }
+
+private:
+    static size_t index(uint64_t v)
+    {
+        if (v < (uint64_t)SUB) return (size_t)v;
+        int e = 63 - __builtin_clzll(v);
+        if (e > MAX_EXP) return BUCKETS - 1;
+        uint64_t sub = (v >> (e - SUB_BITS)) & (SUB - 1);
+        return (size_t)((e - SUB_BITS + 1) * SUB + sub);
+    }
+
+    // bucket 하한값
+    static uint64_t value(size_t i)
+    {
+        if (i < (size_t)SUB) return i;
+        int e = (int)(i / SUB) + SUB_BITS - 1;
+        uint64_t sub = i % SUB;
+        return (1ULL << e) | (sub << (e - SUB_BITS));
+    }
+
+    std::vector<uint64_t> counts_;
+    uint64_t n_ = 0;
+    double   sum_ = 0, sumsq_ = 0;
+    uint64_t min_ = UINT64_MAX, max_ = 0;
+};
@@ -0,0 +1,169 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "bench_config.h"
+#include "cpu_load.h"
+#include "npu_workload.h"
+#include "phase_runner.h"
+#include "workload.h"
+
+// ============================================================
+// DDR bandwidth: STREAM 스타일 copy / triad worker
+//
+// stress-ng --vm 은 메모리 압박만 주고 대역폭은 측정하지 않는다.
+// 여기서는 thread별 배열을 chunk 단위로 돌면서 실제 이동한 byte를
+// 누적 (STREAM 규칙: copy = 2 × 8B, triad = 3 × 8B per element).
+//
+// ddr mode: npu → mem → both phase 로 양쪽 대역폭과 손실을 비교.
+// NPU 쪽은 (A + B + C tensor size) × runs/s 로 산출 (tiling에 의한
+// 재읽기는 포함되지 않으므로 하한값).
+// ============================================================
+
+class MemBwWorkload : public Workload
+{
+public:
+    explicit MemBwWorkload(const MemBwConfig& cfg)
+        : cfg_(cfg), triad_(cfg.kernel != "copy"), bytes_(cfg.threads)
+    {}
+
+    ~MemBwWorkload() override { stop(); }
+
+    std::string name() const override { return triad_ ? "mem_triad" : "mem_copy"; }
+    const char* unit() const override { return "GB/s"; }
+
+    bool prepare() override
+    {
+        if (!arrays_.empty()) return true;
+        const int    n_arrays = triad_ ? 3 : 2;
+        const size_t n = (size_t)cfg_.mb * 1024 * 1024 / n_arrays / sizeof(double);
+        arrays_.resize(cfg_.threads);
+        for (auto& a : arrays_) {
+            a.resize(n_arrays);
+            for (int k = 0; k < n_arrays; k++) a[k].assign(n, 1.0 + k);  // 페이지 실제 할당
+        }
+        return true;
+    }
+
+    void start(bench_clock::time_point t0) override
+    {
+        stop();
+        prepare();
+        for (auto& b : bytes_) b.v.store(0);
+        running_.store(true);
+        for (int i = 0; i < cfg_.threads; i++)
+            threads_.emplace_back([this, i, t0] { worker(i, t0); });
+    }
+
+    // 누적 GB
+    double total() const override
+    {
+        uint64_t b = 0;
+        for (auto& x : bytes_) b += x.v.load(std::memory_order_relaxed);
+        return b / 1e9;
+    }
+
+    void report(std::ostream& os) const override
+    {
+        os << "  Memory streams: " << cfg_.threads << " x " << cfg_.mb << " MB "
+           << (triad_ ? "triad" : "copy") << "\n";
+    }
+
+private:
+    void worker(int i, bench_clock::time_point t0)
+    {
+        if (!cfg_.cores.empty())
+            pin_thread_to_cpu(cfg_.cores[i % cfg_.cores.size()]);
+
+        auto& arr = arrays_[i];
+        const size_t n = arr[0].size();
+        const size_t chunk = 128 * 1024;                 // 1 MB (double) 단위로 counter 갱신
+        const double scalar = 3.0;
+        const uint64_t bytes_per_elem = (triad_ ? 3 : 2) * sizeof(double);
+
+        std::this_thread::sleep_until(t0);
+        while (running_.load(std::memory_order_relaxed)) {
+            for (size_t s = 0; s < n && running_.load(std::memory_order_relaxed); s += chunk) {
+                const size_t e = std::min(n, s + chunk);
+                double* __restrict a = arr[0].data();
+                const double* __restrict b = arr[1].data();
+                if (triad_) {
+                    const double* __restrict c = arr[2].data();
+                    for (size_t j = s; j < e; j++) a[j] = b[j] + scalar * c[j];
+                } else {
+                    for (size_t j = s; j < e; j++) a[j] = b[j];
+                }
+                bytes_[i].v.fetch_add((e - s) * bytes_per_elem, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    MemBwConfig cfg_;
+    bool triad_;
+    std::vector<std::vector<std::vector<double>>> arrays_;
+    std::vector<PaddedCounter> bytes_;
+};
+
+// ============================================================
+// ddr mode
+// ============================================================
+inline int run_ddr_contention(const BenchConfig& cfg, ThermalSampler& sampler,
+                              std::atomic<bool>& running)
+{
+    NpuWorkload   npu("npu", cfg.M, cfg.K, cfg.N, cfg.type);
+    MemBwWorkload mem(cfg.mem);
+
+    std::cout << "Preparing NPU contexts and " << cfg.mem.threads << " x "
+              << cfg.mem.mb << " MB stream buffers..." << std::endl;
+    if (!npu.prepare() || !mem.prepare()) return 1;
+
+    const double npu_bytes_per_run = (double)npu.bytes_per_run();
+
+    std::ofstream timeline;
+    if (!cfg.csv_path.empty()) timeline.open(cfg.csv_path);
+    PhaseRunner runner(sampler, running, {&npu, &mem}, timeline.is_open() ? &timeline : nullptr);
+
+    std::vector<PhaseResult> res;
+    res.push_back(runner.run("npu", {&npu}, cfg.phase_sec));
+    if (running.load()) res.push_back(runner.run("mem", {&mem}, cfg.phase_sec));
+    if (running.load()) res.push_back(runner.run("both", {&npu, &mem}, cfg.phase_sec));
+
+    // GOPS → runs/s → derived GB/s
+    auto npu_gbps = [&](double gops) {
+        return gops * 1e9 / npu.ops_per_run() * npu_bytes_per_run / 1e9;
+    };
+
+    std::cout << "\n═══ DDR Contention Summary ═══\n"
+              << "MatMul " << cfg.M << "x" << cfg.K << "x" << cfg.N << " " << type_name(cfg.type)
+              << "  (A+B+C = " << std::fixed << std::setprecision(2)
+              << npu_bytes_per_run / 1e6 << " MB/run)\n"
+              << "CPU streams: " << cfg.mem.threads << " x " << cfg.mem.mb << " MB "
+              << cfg.mem.kernel << "\n\n"
+              << std::left << std::setw(8) << "phase" << std::right
+              << std::setw(12) << "NPU GOPS" << std::setw(16) << "NPU GB/s(der)"
+              << std::setw(12) << "CPU GB/s" << std::setw(12) << "total GB/s" << "\n";
+    for (auto& r : res) {
+        double ng = npu_gbps(r.rate[0]);
+        std::cout << std::left << std::setw(8) << r.label << std::right
+                  << std::setw(12) << std::setprecision(1) << r.rate[0]
+                  << std::setw(16) << std::setprecision(2) << ng
+                  << std::setw(12) << r.rate[1]
+                  << std::setw(12) << ng + r.rate[1]
+                  << (r.complete ? "" : "  (interrupted)") << "\n";
+    }
+    if (res.size() == 3) {
+        if (res[0].rate[0] > 0)
+            std::cout << "\n  NPU GOPS loss with CPU streams : " << std::setprecision(1)
+                      << (1.0 - res[2].rate[0] / res[0].rate[0]) * 100.0 << "%\n";
+        if (res[1].rate[1] > 0)
+            std::cout << "  CPU GB/s loss with NPU load    : " << std::setprecision(1)
+                      << (1.0 - res[2].rate[1] / res[1].rate[1]) * 100.0 << "%\n";
+    }
+    return 0;
+}
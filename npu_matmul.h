@@ -0,0 +1,270 @@
+#pragma once
+#include <rknn_matmul_api.h>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+
+#include "bench_common.h"
+#include "data_gen.h"
+#include "proc_mem.h"
+#include "thermal_sampler.h"
+#include "thread_cpu.h"
+
+// ============================================================
+// RKNN matmul context wrapper + per-core stats
+// (bench_robot.cpp 및 각 mode header 공용)
+// ============================================================
+
+// -------- NPU 코어 마스크 배열 (Core 0, 1, 2) --------
+static const rknn_core_mask CORE_MASKS[3] = {
+    RKNN_NPU_CORE_0,
+    RKNN_NPU_CORE_1,
+    RKNN_NPU_CORE_2,
+};
+
+// ============================================================
+// RKNNMatMul 생성 단계별 시간 (ns). on-demand context 생성 비용 분석용
+// ============================================================
+struct StartupTimes {
+    uint64_t create = 0, core_mask = 0;
+    uint64_t mem_a = 0, mem_b = 0, mem_c = 0;   // rknn_create_mem
+    uint64_t fill = 0, copy = 0, set_io = 0;    // data 생성 / memcpy (staged 만) / set_io_mem
+    uint64_t first_run = 0;                     // 첫 rknn_matmul_run
+
+    uint64_t init_total() const
+    {
+        return create + core_mask + mem_a + mem_b + mem_c + fill + copy + set_io;
+    }
+};
+
+// ============================================================
+// RKNNMatMul wrapper
+// ============================================================
+struct RKNNMatMul
+{
+    int m, k, n;
+    rknn_tensor_type type;      // 실제 헤더: rknn_tensor_type
+    rknn_matmul_ctx  ctx = 0;
+    rknn_matmul_info info;
+    rknn_matmul_io_attr attr;
+    rknn_tensor_mem *A = nullptr, *B = nullptr, *C = nullptr;
+    bool valid = false;
+    StartupTimes startup;
+
+    bool owns_b = true;         // false: 다른 context 의 B 를 bind (shared B)
+
+    // native_layout : B 행렬 native layout (0=normal, 1=native)
+    // perf_layout   : A/C 행렬 perf layout  (0=normal, 1=perf)
+    // core_mask     : 이 인스턴스를 실행할 NPU 코어
+    // b_from        : 주어지면 B 를 새로 만들지 않고 b_from->B 를 set_io_mem 으로 bind.
+    //                 같은 shape / type / layout 이어야 하고, b_from 이 먼저 파괴되면 안 됨
+    RKNNMatMul(int m, int k, int n, rknn_tensor_type type,
+               int native_layout, int perf_layout,
+               rknn_core_mask core_mask = RKNN_NPU_CORE_AUTO,
+               const RKNNMatMul* b_from = nullptr)
+        : m(m), k(k), n(n), type(type)
+    {
+        memset(&info, 0, sizeof(info));
+        info.M             = m;
+        info.K             = k;
+        info.N             = n;
+        info.type          = type;
+        info.native_layout = native_layout;
+        info.perf_layout   = perf_layout;
+
+        memset(&attr, 0, sizeof(attr));
+        auto t = bench_clock::now();
+        auto lap = [&t](uint64_t& dst) {
+            const auto now = bench_clock::now();
+            dst = elapsed_ns(t, now);
+            t = now;
+        };
+        int ret = rknn_matmul_create(&ctx, &info, &attr);
+        lap(startup.create);
+        if (ret != 0) {
+            std::cerr << "rknn_matmul_create failed: " << ret << std::endl;
+            return;
+        }
+
+        // 코어 고정
+        ret = rknn_matmul_set_core_mask(ctx, core_mask);
+        lap(startup.core_mask);
+        if (ret != 0) {
+            std::cerr << "rknn_matmul_set_core_mask failed: " << ret << std::endl;
+            return;
+        }
+
+        // 입력 데이터: DMA buffer (A/B->virt_addr) 에 직접 생성 (zero-copy)
+        // host staging buffer 를 두지 않으므로 peak RSS 와 memcpy 시간이 빠진다.
+        // 생성 data 는 i.i.d. (또는 file 의 raw byte) 라 layout packing 이 필요 없고,
+        // attr.X.size 전체 (padding 포함) 를 채운다.
+        size_t elem_bytes;
+        if (type == RKNN_TENSOR_INT8) {
+            elem_bytes = 1;
+        } else if (type == RKNN_TENSOR_FLOAT16) {
+            elem_bytes = 2;
+        } else {
+            std::cerr << "Unsupported type" << std::endl;
+            return;
+        }
+
+        if (b_from && (!b_from->B || b_from->attr.B.size != attr.B.size)) {
+            std::cerr << "shared B: size mismatch (" << attr.B.size << " vs "
+                      << (b_from->B ? b_from->attr.B.size : 0) << ")" << std::endl;
+            return;
+        }
+
+        t = bench_clock::now();
+        A = rknn_create_mem(ctx, attr.A.size);
+        lap(startup.mem_a);
+        if (b_from) {
+            B = b_from->B;
+            owns_b = false;
+        } else {
+            B = rknn_create_mem(ctx, attr.B.size);
+        }
+        lap(startup.mem_b);
+        C = rknn_create_mem(ctx, attr.C.size);
+        lap(startup.mem_c);
+        if (!A || !B || !C) {
+            std::cerr << "rknn_create_mem failed" << std::endl;
+            return;
+        }
+
+        // (seed, core, tensor) 로 결정 → --seed 가 같으면 bit-exact 재현 (data_gen.h)
+        // FP16 은 fp32 분포 → IEEE half (--fp16-dist), data mode 는 tensor 별 pattern
+        const uint64_t seed = datagen::seed();
+        const bool fp16 = type == RKNN_TENSOR_FLOAT16;
+        const size_t a_count = A->size / elem_bytes, b_count = B->size / elem_bytes;
+        if (datagen::params().staged_init) {
+            // 이전 방식 (--staged-init, init mode 비교용): malloc → fill → memcpy → free
+            void* a_data = malloc(A->size);
+            void* b_data = owns_b ? malloc(B->size) : nullptr;
+            datagen::fill_tensor(a_data, a_count, fp16, 'A', k, seed, datagen::tensor_stream(core_mask, 'A'));
+            if (owns_b)
+                datagen::fill_tensor(b_data, b_count, fp16, 'B', k, seed, datagen::tensor_stream(core_mask, 'B'));
+            lap(startup.fill);
+            memcpy(A->virt_addr, a_data, A->size);
+            if (owns_b) memcpy(B->virt_addr, b_data, B->size);
+            free(a_data);
+            free(b_data);
+            lap(startup.copy);
+        } else {
+            datagen::fill_tensor(A->virt_addr, a_count, fp16, 'A', k, seed, datagen::tensor_stream(core_mask, 'A'));
+            if (owns_b)
+                datagen::fill_tensor(B->virt_addr, b_count, fp16, 'B', k, seed, datagen::tensor_stream(core_mask, 'B'));
+            lap(startup.fill);
+        }
+
+        // shared B 는 다른 context 의 mem 을 bind → runtime 이 거부하면 여기서 실패
+        const struct { const char* name; rknn_tensor_mem* mem; rknn_matmul_tensor_attr* attr; } io[] = {
+            {"A", A, &attr.A}, {owns_b ? "B" : "B (shared)", B, &attr.B}, {"C", C, &attr.C},
+        };
+        for (auto& t : io) {
+            ret = rknn_matmul_set_io_mem(ctx, t.mem, t.attr);
+            if (ret != 0) {
+                std::cerr << "rknn_matmul_set_io_mem " << t.name << " failed: " << ret << std::endl;
+                return;
+            }
+        }
+        lap(startup.set_io);
+        valid = true;
+    }
+
+    // 이 context 가 할당한 DMA byte (빌려온 shared B 제외)
+    uint64_t dma_bytes() const
+    {
+        return (uint64_t)attr.A.size + attr.C.size + (owns_b ? attr.B.size : 0);
+    }
+
+    int run()
+    {
+        if (startup.first_run) return rknn_matmul_run(ctx);
+        const auto t0 = bench_clock::now();
+        const int ret = rknn_matmul_run(ctx);
+        startup.first_run = elapsed_ns(t0, bench_clock::now());
+        return ret;
+    }
+
+    ~RKNNMatMul()
+    {
+        if (A) rknn_destroy_mem(ctx, A);
+        if (B && owns_b) rknn_destroy_mem(ctx, B);
+        if (C) rknn_destroy_mem(ctx, C);
+        if (ctx) rknn_matmul_destroy(ctx);
+    }
+};
+
+// ============================================================
+// Per-core stats
+// ============================================================
+struct CoreStats {
+    std::atomic<uint64_t> total_runs{0};
+    std::atomic<uint64_t> total_ns{0};
+    std::atomic<double>   peak_gops{0.0};
+
+    // worker thread host CPU 사용량 (warm-up 이후 누적, thread_cpu.h)
+    // worker가 ~10ms마다 publish, monitor가 interval 차분으로 CPU% 계산
+    std::atomic<uint64_t> cpu_ns{0}, user_ns{0}, sys_ns{0}, nvcsw{0}, nivcsw{0};
+
+    // 시작 barrier 기준 (stress mode): context 생성 / warm-up 시간, t0 대비 첫 run 시작
+    std::atomic<uint64_t> init_ns{0}, warmup_ns{0};
+    std::atomic<int64_t>  start_offset_ns{0};
+    std::atomic<bool>     started{false};
+
+    // context DMA buffer 크기 (attr.A/B/C.size). worker 가 init 때 한 번 기록
+    std::atomic<uint64_t> a_bytes{0}, b_bytes{0}, c_bytes{0};
+    std::atomic<bool>     owns_b{true};
+
+    void publish_cpu(const ThreadCpuSample& s)
+    {
+        cpu_ns.store(s.cpu_ns);  user_ns.store(s.user_ns);  sys_ns.store(s.sys_ns);
+        nvcsw.store(s.nvcsw);    nivcsw.store(s.nivcsw);
+    }
+    ThreadCpuSample cpu() const
+    {
+        return {cpu_ns.load(), user_ns.load(), sys_ns.load(), nvcsw.load(), nivcsw.load()};
+    }
+};
+
+// run 1회 기록 (--run-log). 모든 시각은 bench_now_ns() 기준.
+struct RunSample {
+    uint64_t t_end_ns;
+    uint64_t run_ns;
+    ThermalSnapshot thermal;
+};
+
+// M x K x N matmul 1회의 연산량 (MAC당 곱+합, 마지막 합 제외)
+inline uint64_t matmul_ops(int m, int k, int n)
+{
+    return (uint64_t)m * n * (2ULL * k - 1);
+}
+
+inline const char* type_name(rknn_tensor_type type)
+{
+    return type == RKNN_TENSOR_FLOAT16 ? "FP16" : "INT8";
+}
+
+// context 별 attr.A/B/C.size + DMA 합계 + host RSS (stress summary)
+// running_rss_kb: 모든 worker 가 start barrier 를 지난 시점의 VmRSS (-1 = 측정 못 함).
+// summary 시점에는 context 가 이미 해제되어 있으므로 현재 RSS 는 쓰지 않는다.
+inline void print_memory_footprint(std::ostream& os, const CoreStats* stats, int cores, long running_rss_kb)
+{
+    uint64_t total = 0;
+    os << "Memory footprint:\n" << std::fixed << std::setprecision(2);
+    for (int i = 0; i < cores; i++) {
+        const uint64_t a = stats[i].a_bytes.load(), b = stats[i].b_bytes.load(), c = stats[i].c_bytes.load();
+        if (!a && !b && !c) continue;
+        const bool owns = stats[i].owns_b.load();
+        total += a + c + (owns ? b : 0);
+        os << "  Core " << i << ": A " << a / 1048576.0 << " MB, B " << b / 1048576.0
+           << (owns ? " MB" : " MB (shared)") << ", C " << c / 1048576.0 << " MB\n";
+    }
+    os << "  DMA total " << total / 1048576.0 << " MB, host RSS while running ";
+    if (running_rss_kb >= 0) os << running_rss_kb / 1024.0 << " MB";
+    else                     os << "N/A";
+    os << " (peak " << peak_rss_kb() / 1024.0 << " MB)\n";
+}
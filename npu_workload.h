@@ -0,0 +1,146 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "latency_stats.h"
+#include "npu_matmul.h"
+#include "thread_placement.h"
+#include "workload.h"
+
+// ============================================================
+// NPU workload: 코어별 RKNNMatMul 을 back-to-back 으로 실행
+//
+// context는 prepare()에서 한 번만 만들고 phase 마다 재사용한다.
+// (phase 시작 시 context 생성 비용이 측정에 섞이지 않도록)
+// ============================================================
+class NpuWorkload : public Workload
+{
+public:
+    NpuWorkload(std::string label, int m, int k, int n,
+                rknn_tensor_type type, int num_cores = 3)
+        : label_(std::move(label)), m_(m), k_(k), n_(n), type_(type),
+          num_cores_(num_cores), ops_per_run_(matmul_ops(m, k, n)),
+          runs_(num_cores), lat_(num_cores), placement_(num_cores)
+    {}
+
+    ~NpuWorkload() override
+    {
+        stop();
+        release();
+    }
+
+    std::string name() const override { return label_; }
+    const char* unit() const override { return "GOPS"; }
+
+    bool prepare() override
+    {
+        if (!matmuls_.empty()) return true;
+        for (int i = 0; i < num_cores_; i++) {
+            const RKNNMatMul* b_from = shared_b_ && i > 0 ? matmuls_[0].get() : nullptr;
+            auto mm = std::make_unique<RKNNMatMul>(m_, k_, n_, type_, 1, 1, CORE_MASKS[i], b_from);
+            if (!mm->valid) {
+                std::cerr << "[" << label_ << "] Core " << i << " init failed!" << std::endl;
+                release();
+                return false;
+            }
+            for (int w = 0; w < 5; w++) mm->run();   // warm-up
+            matmuls_.push_back(std::move(mm));
+        }
+        return true;
+    }
+
+    void start(bench_clock::time_point t0) override
+    {
+        stop();
+        for (auto& r : runs_) r.v.store(0);
+        for (auto& l : lat_) l.reset();
+        running_.store(true);
+        for (int i = 0; i < (int)matmuls_.size(); i++) {
+            threads_.emplace_back([this, i, t0] {
+                apply_placement(placement_[i], label_.c_str());
+                std::this_thread::sleep_until(t0);
+                while (running_.load()) {
+                    auto a = bench_clock::now();
+                    matmuls_[i]->run();
+                    auto b = bench_clock::now();
+                    lat_[i].add(elapsed_ns(a, b));
+                    runs_[i].v.fetch_add(1, std::memory_order_relaxed);
+
+                    // duty < 1: run 시간에 비례한 idle → issue rate = duty × 최대
+                    const double d = duty_.load(std::memory_order_relaxed);
+                    if (d < 1.0)
+                        std::this_thread::sleep_until(
+                            b + std::chrono::nanoseconds((int64_t)(elapsed_ns(a, b) * (1.0 - d) / d)));
+                }
+            });
+        }
+    }
+
+    // 누적 GOP (완료된 run 만)
+    double total() const override
+    {
+        uint64_t runs = 0;
+        for (auto& r : runs_) runs += r.v.load(std::memory_order_relaxed);
+        return runs * (double)ops_per_run_ / 1e9;
+    }
+
+    uint64_t core_runs(int i) const { return runs_[i].v.load(); }
+
+    // prepare() 전에 설정. core 0 context 의 B 를 나머지 core 가 같이 bind
+    // (weight 1벌을 3 core 가 공유하는 배포 형태, B DMA footprint 1/3)
+    void set_shared_b(bool on) { shared_b_ = on; }
+    bool shared_b() const { return shared_b_; }
+
+    // 모든 context 의 DMA buffer 합 (shared B 는 한 번만)
+    uint64_t dma_bytes() const
+    {
+        uint64_t b = 0;
+        for (auto& mm : matmuls_) b += mm->dma_bytes();
+        return b;
+    }
+
+    // 다음 start() 부터 적용. worker i → placement[i]
+    void set_placement(const std::vector<ThreadPlacement>& p)
+    {
+        for (int i = 0; i < num_cores_; i++)
+            placement_[i] = i < (int)p.size() ? p[i] : ThreadPlacement{};
+    }
+
+    // core별 issue duty (0 < d <= 1). 동작 중에도 바로 반영 (thermal governor 용)
+    void set_duty(double d) { duty_.store(std::min(1.0, std::max(0.01, d))); }
+    double duty() const { return duty_.load(); }
+
+    // 마지막 phase의 run latency (rknn_matmul_run 호출 시간). stop() 후에 읽을 것.
+    const LatencyHistogram& latency(int core) const { return lat_[core]; }
+    uint64_t ops_per_run() const { return ops_per_run_; }
+
+    // context 1개가 run 1회에 건드리는 tensor byte (A + B + C)
+    uint64_t bytes_per_run() const
+    {
+        if (matmuls_.empty()) return 0;
+        const auto& a = matmuls_[0]->attr;
+        return (uint64_t)a.A.size + a.B.size + a.C.size;
+    }
+
+private:
+    // B 를 빌려 쓴 context 부터 (역순) 파괴 → B owner 인 core 0 이 마지막
+    void release()
+    {
+        while (!matmuls_.empty()) matmuls_.pop_back();
+    }
+
+    std::string label_;
+    int m_, k_, n_;
+    rknn_tensor_type type_;
+    int num_cores_;
+    uint64_t ops_per_run_;
+    std::vector<std::unique_ptr<RKNNMatMul>> matmuls_;
+    std::vector<PaddedCounter> runs_;
+    std::vector<LatencyHistogram> lat_;
+    std::vector<ThreadPlacement> placement_;
+    std::atomic<double> duty_{1.0};
+    bool shared_b_ = false;
+};
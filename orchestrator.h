@@ -0,0 +1,179 @@
+#pragma once
+#include <atomic>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <sys/utsname.h>
+#include <vector>
+
+#include "bench_config.h"
+#include "cpu_load.h"
+#include "npu_workload.h"
+#include "phase_runner.h"
+#include "rt_probe.h"
+#include "thermal_sampler.h"
+
+// ============================================================
+// Orchestrate mode: run_stress_test.sh cpu|npu|both 대체
+//
+//   ./bench M K N type --mode orchestrate --phase-sec 60
+//
+// baseline → cpu → npu → both phase를 하나의 프로세스, 하나의
+// monotonic clock 위에서 연속 실행하고 결과를 한 디렉터리에 저장:
+//   system_info.txt : 시작 시 시스템 상태
+//   timeline.csv    : 1초 단위 NPU/CPU GOPS + thermal state
+//   summary.txt     : phase별 평균 + interference (상호 GOPS 손실)
+// ============================================================
+
+inline void write_system_info(std::ostream& os, const BenchConfig& cfg,
+                              const ThermalSampler& sampler)
+{
+    utsname u{};
+    uname(&u);
+    os << "# Pre-test system state\n"
+       << "Date: " << timestamp_str() << "\n"
+       << "Kernel: " << u.release << "\n"
+       << "Mode: " << cfg.mode << "\n"
+       << "MatMul: " << cfg.M << "x" << cfg.K << "x" << cfg.N
+       << " " << type_name(cfg.type) << "\n\n";
+
+    std::string s;
+    os << "--- RKNPU Driver ---\n"
+       << (cfg.sysfs.read_string("/sys/kernel/debug/rknpu/version", s) ? s : "N/A") << "\n\n";
+
+    os << "--- Thermal Zone Mapping ---\n";
+    for (auto& z : cfg.sysfs.list_dir("/sys/class/thermal/", "thermal_zone")) {
+        std::string type;
+        cfg.sysfs.read_string("/sys/class/thermal/" + z + "/type", type);
+        os << "  " << z << ": " << type << "\n";
+    }
+    os << "\n--- CPU Freq Policy ---\n";
+    for (int c : {0, 4, 6}) {
+        std::string gov;
+        const std::string base = "/sys/devices/system/cpu/cpu" + std::to_string(c) + "/cpufreq/";
+        cfg.sysfs.read_string(base + "scaling_governor", gov);
+        os << "  CPU" << c << ": governor=" << gov
+           << ", max_freq=" << cfg.sysfs.read_ll(base + "scaling_max_freq", 0) / 1000 << "MHz\n";
+    }
+    os << "\n";
+    sampler.print_config(os);
+}
+
+inline int run_orchestrator(const BenchConfig& cfg, ThermalSampler& sampler,
+                            std::atomic<bool>& running)
+{
+    const std::string dir = cfg.out_dir.empty()
+        ? "rk3588_orchestrate_" + timestamp_str() : cfg.out_dir;
+    if (!make_dirs(dir)) {
+        std::cerr << "Cannot create " << dir << std::endl;
+        return 1;
+    }
+
+    {
+        std::ofstream info(dir + "/system_info.txt");
+        write_system_info(info, cfg, sampler);
+    }
+
+    NpuWorkload     npu("npu", cfg.M, cfg.K, cfg.N, cfg.type);
+    CpuLoadWorkload cpu(cfg.sysfs, cfg.cpu_load);
+
+    std::cout << "Preparing NPU contexts..." << std::endl;
+    if (!npu.prepare()) return 1;
+
+    // rt probe 는 모든 phase (baseline 포함) 에서 같이 돈다
+    RtProbeWorkload probe(cfg.rt_probe);
+    const bool use_probe = cfg.rt_probe.cpu >= 0;
+    std::vector<Workload*> columns = {&npu, &cpu};
+    if (use_probe) columns.push_back(&probe);
+
+    std::ofstream timeline(dir + "/timeline.csv");
+    PhaseRunner runner(sampler, running, columns, &timeline);
+
+    struct ProbeRow {
+        std::string label;
+        LatencyHistogram wake, over;
+        uint64_t cycles, overruns;
+    };
+    std::vector<ProbeRow> probe_rows;
+
+    std::vector<PhaseResult> results;
+    for (int p : {0, 1, 2, 3}) {
+        static const char* names[] = {"baseline", "cpu", "npu", "both"};
+        const std::string label = names[p];
+        if (("," + cfg.phases + ",").find("," + label + ",") == std::string::npos) continue;
+        if (!running.load()) break;
+
+        std::vector<Workload*> active;
+        if (label == "cpu" || label == "both") active.push_back(&cpu);
+        if (label == "npu" || label == "both") active.push_back(&npu);
+        if (use_probe) active.push_back(&probe);
+        results.push_back(runner.run(label, active, cfg.phase_sec));
+        if (use_probe)
+            probe_rows.push_back({label, probe.wake_latency(), probe.overrun_time(),
+                                  probe.cycles(), probe.overruns()});
+    }
+
+    // ---- summary ----
+    auto find = [&](const std::string& l) -> const PhaseResult* {
+        for (auto& r : results) if (r.label == l && r.seconds > 0) return &r;
+        return nullptr;
+    };
+
+    std::ofstream sum(dir + "/summary.txt");
+    for (std::ostream* os : {(std::ostream*)&std::cout, (std::ostream*)&sum}) {
+        *os << "\n═══ Orchestrate Summary ═══\n"
+            << "MatMul " << cfg.M << "x" << cfg.K << "x" << cfg.N << " " << type_name(cfg.type)
+            << ", CPU load A55 " << cfg.cpu_load.load_a55 << "% / A76 " << cfg.cpu_load.load_a76
+            << "% on " << cpu.num_workers() << " cores, phase " << cfg.phase_sec << "s\n\n"
+            << std::left << std::setw(10) << "phase" << std::right
+            << std::setw(8) << "sec" << std::setw(12) << "NPU GOPS" << std::setw(12) << "CPU GOPS"
+            << std::setw(10) << "T mean" << std::setw(10) << "T max" << std::setw(10) << "throttle"
+            << "\n";
+        for (auto& r : results) {
+            *os << std::left << std::setw(10) << r.label << std::right << std::fixed
+                << std::setw(8) << std::setprecision(0) << r.seconds
+                << std::setw(12) << std::setprecision(1) << r.rate[0]
+                << std::setw(12) << r.rate[1]
+                << std::setw(10) << r.temp_mean << std::setw(10) << r.temp_max
+                << std::setw(9) << r.throttle_frac * 100.0 << "%"
+                << (r.complete ? "" : "  (interrupted)") << "\n";
+        }
+        for (auto& r : results)
+            if (!r.details.empty()) *os << "\n[" << r.label << "]\n" << r.details;
+
+        *os << "\nInterference:\n";
+        const PhaseResult *pc = find("cpu"), *pn = find("npu"), *pb = find("both");
+        if (pn && pb && pn->rate[0] > 0)
+            *os << "  NPU GOPS loss with CPU load : " << std::setprecision(1)
+                << (1.0 - pb->rate[0] / pn->rate[0]) * 100.0 << "%\n";
+        else
+            *os << "  NPU GOPS loss with CPU load : N/A (need npu + both)\n";
+        if (pc && pb && pc->rate[1] > 0)
+            *os << "  CPU GOPS loss with NPU load : " << std::setprecision(1)
+                << (1.0 - pb->rate[1] / pc->rate[1]) * 100.0 << "%\n";
+        else
+            *os << "  CPU GOPS loss with NPU load : N/A (need cpu + both)\n";
+
+        if (!probe_rows.empty()) {
+            *os << "\nControl loop (" << ThreadPlacement{cfg.rt_probe.cpu, cfg.rt_probe.rt_prio}.str()
+                << ", " << cfg.rt_probe.hz << " Hz, work " << cfg.rt_probe.work_us << " us), wake latency us:\n"
+                << std::left << std::setw(10) << "phase" << std::right
+                << std::setw(10) << "p50" << std::setw(10) << "p99" << std::setw(10) << "p99.9"
+                << std::setw(10) << "max" << std::setw(12) << "overruns" << std::setw(12) << "worst over"
+                << "\n";
+            for (auto& p : probe_rows) {
+                *os << std::left << std::setw(10) << p.label << std::right << std::fixed
+                    << std::setprecision(1)
+                    << std::setw(10) << p.wake.percentile(50) / 1e3
+                    << std::setw(10) << p.wake.percentile(99) / 1e3
+                    << std::setw(10) << p.wake.percentile(99.9) / 1e3
+                    << std::setw(10) << p.wake.max() / 1e3
+                    << std::setw(12) << p.overruns
+                    << std::setw(12) << p.over.max() / 1e3 << "\n";
+            }
+        }
+    }
+    std::cout << "\nResults saved to: " << dir << "/\n";
+    return 0;
+}
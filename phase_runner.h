@@ -0,0 +1,140 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "bench_common.h"
+#include "thermal_sampler.h"
+#include "workload.h"
+
+// ============================================================
+// Phase runner
+//
+// 하나의 phase = 고정 시간 동안 일부 workload를 동시에 구동.
+//   1) 모든 active workload에 같은 t_start (now + lead) 전달
+//   2) t_start 부터 1초 간격으로 timeline 기록 (같은 monotonic clock)
+//   3) t_end 에서 total() snapshot 후 stop
+// rate = (t_end snapshot) / phase 길이 → 정지 지연이 결과에 섞이지 않음
+// ============================================================
+struct PhaseResult {
+    std::string label;
+    double seconds = 0;                 // 실제 측정 길이 (Ctrl+C 시 짧아짐)
+    std::vector<bool>   active;         // columns 순서
+    std::vector<double> rate;           // unit/s, inactive 는 0
+    double temp_mean = 0, temp_max = 0;
+    double throttle_frac = 0;           // throttle 중이던 sample 비율
+    bool   complete = true;
+    std::string details;                // Workload::report() 출력
+};
+
+class PhaseRunner
+{
+public:
+    PhaseRunner(ThermalSampler& sampler, std::atomic<bool>& running,
+                std::vector<Workload*> columns, std::ofstream* timeline)
+        : sampler_(sampler), running_(running),
+          columns_(std::move(columns)), timeline_(timeline)
+    {
+        if (timeline_) {
+            *timeline_ << "phase,t_sec,phase_t_sec";
+            for (auto* w : columns_)
+                *timeline_ << "," << w->name() << "_" << w->unit();
+            *timeline_ << ",npu_temp_c,npu_freq_mhz,throttle_level,throttle_mask\n";
+        }
+    }
+
+    PhaseResult run(const std::string& label,
+                    const std::vector<Workload*>& active, int seconds)
+    {
+        PhaseResult res;
+        res.label = label;
+        res.active.assign(columns_.size(), false);
+        res.rate.assign(columns_.size(), 0.0);
+        for (size_t c = 0; c < columns_.size(); c++)
+            res.active[c] = std::find(active.begin(), active.end(), columns_[c]) != active.end();
+
+        // thread 생성/대기 진입 시간을 흡수하는 lead time
+        const auto t_start = bench_clock::now() + std::chrono::milliseconds(200);
+        for (auto* w : active) w->start(t_start);
+
+        std::cout << "\n▶ Phase [" << label << "] " << seconds << "s  (";
+        for (size_t i = 0; i < active.size(); i++)
+            std::cout << (i ? ", " : "") << active[i]->name();
+        std::cout << (active.empty() ? "idle)" : ")") << std::endl;
+
+        std::vector<double> prev(columns_.size(), 0.0);
+        double temp_sum = 0;
+        int temp_n = 0, throttle_n = 0, samples = 0;
+        res.temp_max = 0;
+
+        int sec = 0;
+        for (; sec < seconds && running_.load(); sec++) {
+            std::this_thread::sleep_until(t_start + std::chrono::seconds(sec + 1));
+            ThermalSnapshot th = sampler_.latest();
+            samples++;
+            if (th.has_temp()) {
+                temp_sum += th.temp_c();
+                temp_n++;
+                res.temp_max = std::max(res.temp_max, th.temp_c());
+            }
+            if (th.throttled()) throttle_n++;
+
+            const double t_now = elapsed_ns(bench_t0(), bench_clock::now()) / 1e9;
+            if (timeline_) *timeline_ << label << "," << std::fixed << std::setprecision(3)
+                                      << t_now << "," << sec + 1;
+
+            std::cout << "  [" << label << " " << std::setw(4) << sec + 1 << "s]" << std::fixed;
+            for (size_t c = 0; c < columns_.size(); c++) {
+                double cur = res.active[c] ? columns_[c]->total() : 0.0;
+                double r = cur - prev[c];
+                prev[c] = cur;
+                if (timeline_) {
+                    *timeline_ << ",";
+                    if (res.active[c]) *timeline_ << std::setprecision(2) << r;
+                }
+                if (res.active[c])
+                    std::cout << "  " << columns_[c]->name() << " " << std::setprecision(1)
+                              << r << " " << columns_[c]->unit();
+            }
+            if (th.has_temp()) std::cout << "  NPU " << std::setprecision(1) << th.temp_c() << "°C";
+            if (th.throttled()) std::cout << "  throttle " << sampler_.throttle_str(th);
+            std::cout << "\n";
+
+            if (timeline_) {
+                *timeline_ << ",";
+                if (th.has_temp()) *timeline_ << std::setprecision(1) << th.temp_c();
+                *timeline_ << "," << std::setprecision(0) << th.freq_mhz()
+                           << "," << th.throttle_level << "," << th.throttle_mask << "\n";
+                timeline_->flush();
+            }
+        }
+
+        res.seconds  = sec;
+        res.complete = (sec == seconds);
+        for (size_t c = 0; c < columns_.size(); c++)
+            if (res.active[c] && sec > 0) res.rate[c] = prev[c] / sec;
+        for (auto* w : active) w->stop();
+
+        std::ostringstream det;
+        for (auto* w : active) w->report(det);
+        res.details = det.str();
+        std::cout << res.details;
+
+        res.temp_mean     = temp_n ? temp_sum / temp_n : 0.0;
+        res.throttle_frac = samples ? (double)throttle_n / samples : 0.0;
+        return res;
+    }
+
+    const std::vector<Workload*>& columns() const { return columns_; }
+
+private:
+    ThermalSampler& sampler_;
+    std::atomic<bool>& running_;
+    std::vector<Workload*> columns_;
+    std::ofstream* timeline_;
+};
@@ -0,0 +1,90 @@
+#pragma once
+#include <atomic>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "bench_config.h"
+#include "latency_stats.h"
+#include "npu_workload.h"
+#include "phase_runner.h"
+#include "thread_placement.h"
+
+// ============================================================
+// Placement mode: submit latency jitter 비교
+//
+//   floating : affinity 지정 없음 (taskset 범위 안에서 migrate)
+//   pinned   : worker i → --worker-cpus[i]   (기본 4,5,6)
+//   rt       : pinned + SCHED_FIFO --rt-prio (기본 50)
+//
+// 각 placement로 phase-sec 동안 NPU stress 후 rknn_matmul_run
+// 호출 시간 분포 (sd, p99, p99.9, max)를 비교한다.
+// ============================================================
+inline std::vector<ThreadPlacement> worker_placements(const BenchConfig& cfg,
+                                                      bool pinned, int rt_prio)
+{
+    static const std::vector<int> default_cpus = {4, 5, 6};
+    const auto& cpus = cfg.worker_cpus.empty() ? default_cpus : cfg.worker_cpus;
+    std::vector<ThreadPlacement> p(3);
+    for (int i = 0; i < 3; i++) {
+        p[i].cpu     = pinned ? cpus[i % cpus.size()] : -1;
+        p[i].rt_prio = rt_prio;
+    }
+    return p;
+}
+
+inline int run_placement_compare(const BenchConfig& cfg, ThermalSampler& sampler,
+                                 std::atomic<bool>& running)
+{
+    NpuWorkload npu("npu", cfg.M, cfg.K, cfg.N, cfg.type);
+    std::cout << "Preparing NPU contexts..." << std::endl;
+    if (!npu.prepare()) return 1;
+
+    struct Variant {
+        const char* label;
+        std::vector<ThreadPlacement> placement;
+        double gops = 0;
+        LatencyHistogram lat;
+        std::vector<LatencyHistogram> per_core;
+    };
+    const int rt = cfg.rt_prio > 0 ? cfg.rt_prio : 50;
+    std::vector<Variant> vs(3);
+    vs[0].label = "floating"; vs[0].placement = worker_placements(cfg, false, 0);
+    vs[1].label = "pinned";   vs[1].placement = worker_placements(cfg, true, 0);
+    vs[2].label = "rt";       vs[2].placement = worker_placements(cfg, true, rt);
+
+    PhaseRunner runner(sampler, running, {&npu}, nullptr);
+    for (auto& v : vs) {
+        if (!running.load()) break;
+        npu.set_placement(v.placement);
+        PhaseResult r = runner.run(v.label, {&npu}, cfg.phase_sec);
+        v.gops = r.rate[0];
+        for (int i = 0; i < 3; i++) {
+            v.lat.merge(npu.latency(i));
+            v.per_core.push_back(npu.latency(i));
+        }
+    }
+
+    std::cout << "\n═══ Placement Summary (rknn_matmul_run latency, ms) ═══\n"
+              << "MatMul " << cfg.M << "x" << cfg.K << "x" << cfg.N << " " << type_name(cfg.type)
+              << ", phase " << cfg.phase_sec << "s\n";
+    for (auto& v : vs) {
+        if (v.lat.count() == 0) continue;
+        std::cout << "\n[" << v.label << "]  ";
+        for (size_t i = 0; i < v.placement.size(); i++)
+            std::cout << (i ? ", " : "") << "w" << i << "=" << v.placement[i].str();
+        std::cout << "\n  GOPS " << std::fixed << std::setprecision(1) << v.gops
+                  << "   jitter (p99 - p50) "
+                  << std::setprecision(3) << (v.lat.percentile(99) - v.lat.percentile(50)) / 1e6
+                  << " ms\n  all   : ";
+        v.lat.print(std::cout);
+        std::cout << "\n";
+        for (size_t i = 0; i < v.per_core.size(); i++) {
+            std::cout << "  core" << i << " : ";
+            v.per_core[i].print(std::cout);
+            std::cout << "\n";
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,163 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "bench_common.h"
+#include "bench_config.h"
+#include "context_pool.h"
+#include "data_gen.h"
+#include "latency_stats.h"
+
+// ============================================================
+// Pool mode: dynamic shape mix replay, context pool 유무 비교
+//
+// --pool-shapes 의 가중치로 (seed 고정) op sequence 를 만들고 같은 sequence 를
+//   no pool : op 마다 RKNNMatMul 생성 → run → 파괴
+//   pool    : ContextPool::acquire (miss 면 생성, budget 초과 시 LRU evict) → run
+// 로 한 thread 에서 재생한다. op latency = acquire/생성 + run (+ 파괴).
+// op i 는 core (i % --pool-cores) 에서 실행 → core 도 key 의 일부.
+// context 생성 시 A/B 는 zeros (memset ≈ 실제 weight upload 비용, random 생성 비용 제외).
+// ============================================================
+struct PoolShape {
+    int m, k, n;
+    double weight;
+};
+
+// "1x2048x2048:40,64x4096x4096:5" (가중치 생략 시 1)
+inline bool parse_pool_shapes(const std::string& s, std::vector<PoolShape>& out)
+{
+    for (auto& tok : parse_name_list(s)) {
+        PoolShape p{0, 0, 0, 1.0};
+        if (std::sscanf(tok.c_str(), "%dx%dx%d:%lf", &p.m, &p.k, &p.n, &p.weight) < 3
+            || p.m <= 0 || p.k <= 0 || p.n <= 0 || p.weight <= 0)
+            return false;
+        out.push_back(p);
+    }
+    return !out.empty();
+}
+
+struct PoolReplayResult {
+    const char* name = "";
+    LatencyHistogram lat;
+    double wall_sec = 0;
+    uint64_t failures = 0;
+};
+
+inline int run_pool_replay(const BenchConfig& cfg, std::atomic<bool>& running)
+{
+    std::vector<PoolShape> shapes;
+    if (!parse_pool_shapes(cfg.pool_shapes, shapes)) {
+        std::cerr << "Bad --pool-shapes: " << cfg.pool_shapes << " (MxKxN[:weight],...)" << std::endl;
+        return 1;
+    }
+    const int cores = std::min(3, std::max(1, cfg.pool_cores));
+
+    // op sequence: 두 경로가 같은 순서를 재생
+    std::vector<double> w;
+    for (auto& p : shapes) w.push_back(p.weight);
+    std::mt19937_64 rng(cfg.seed);
+    std::discrete_distribution<int> pick(w.begin(), w.end());
+    std::vector<int> ops(cfg.pool_ops);
+    for (auto& o : ops) o = pick(rng);
+
+    const uint64_t budget = (uint64_t)cfg.pool_budget_mb << 20;
+    std::cout << "Pool replay: " << shapes.size() << " shapes " << type_name(cfg.type) << ", " << ops.size()
+              << " ops on " << cores << " core(s), budget " << cfg.pool_budget_mb << " MB, seed " << cfg.seed
+              << "\n";
+
+    const datagen::DataParams saved = datagen::params();
+    datagen::params().pattern_a.kind = datagen::DataPattern::Zeros;
+    datagen::params().pattern_b.kind = datagen::DataPattern::Zeros;
+
+    auto key_of = [&](size_t i) {
+        const PoolShape& p = shapes[ops[i]];
+        return ContextKey{p.m, p.k, p.n, cfg.type, 1, 1, (int)(i % cores)};
+    };
+
+    PoolReplayResult direct, pooled;
+    direct.name = "no pool";
+    pooled.name = "pool";
+    ContextPool pool(budget);
+
+    auto t_start = bench_clock::now();
+    for (size_t i = 0; i < ops.size() && running.load(); i++) {
+        const ContextKey key = key_of(i);
+        const auto t0 = bench_clock::now();
+        {
+            RKNNMatMul mm(key.m, key.k, key.n, key.type, key.native_layout, key.perf_layout,
+                          CORE_MASKS[key.core]);
+            if (mm.valid) mm.run();
+            else          direct.failures++;
+        }
+        direct.lat.add(elapsed_ns(t0, bench_clock::now()));
+    }
+    direct.wall_sec = elapsed_ns(t_start, bench_clock::now()) / 1e9;
+
+    t_start = bench_clock::now();
+    for (size_t i = 0; i < ops.size() && running.load(); i++) {
+        const auto t0 = bench_clock::now();
+        RKNNMatMul* mm = pool.acquire(key_of(i));
+        if (mm) mm->run();
+        else    pooled.failures++;
+        pooled.lat.add(elapsed_ns(t0, bench_clock::now()));
+    }
+    pooled.wall_sec = elapsed_ns(t_start, bench_clock::now()) / 1e9;
+    const ContextPool::Stats st = pool.stats();
+    const size_t resident = pool.size();
+    pool.clear();
+    datagen::params() = saved;
+
+    std::cout << "\n═══ Pool Replay Summary ═══\n"
+              << std::left << std::setw(9) << "" << std::right << std::setw(8) << "ops" << std::setw(9) << "wall s"
+              << std::setw(10) << "mean ms" << std::setw(10) << "p50 ms" << std::setw(10) << "p99 ms"
+              << std::setw(11) << "p99.9 ms" << std::setw(10) << "max ms" << std::setw(7) << "fail" << "\n";
+    for (auto* r : {&direct, &pooled}) {
+        std::cout << std::left << std::setw(9) << r->name << std::right << std::setw(8) << r->lat.count()
+                  << std::fixed << std::setprecision(2) << std::setw(9) << r->wall_sec << std::setprecision(3)
+                  << std::setw(10) << r->lat.mean() / 1e6 << std::setw(10) << r->lat.percentile(50) / 1e6
+                  << std::setw(10) << r->lat.percentile(99) / 1e6 << std::setw(11) << r->lat.percentile(99.9) / 1e6
+                  << std::setw(10) << r->lat.max() / 1e6 << std::setw(7) << r->failures << "\n";
+    }
+
+    const uint64_t lookups = st.hits + st.misses;
+    std::cout << std::setprecision(1)
+              << "Pool: hit rate " << (lookups ? st.hits * 100.0 / lookups : 0.0) << "% (" << st.hits << " / "
+              << lookups << "), " << st.misses << " misses, mean create "
+              << std::setprecision(3) << (st.misses ? st.create_ns / 1e6 / st.misses : 0.0) << " ms\n"
+              << "      " << st.evictions << " evictions, mean evict "
+              << (st.evictions ? st.evict_ns / 1e6 / st.evictions : 0.0) << " ms, total evict "
+              << st.evict_ns / 1e6 << " ms\n"
+              << std::setprecision(1) << "      peak " << st.peak_bytes / 1048576.0 << " MB of "
+              << cfg.pool_budget_mb << " MB, " << resident << " contexts resident at end\n";
+    if (direct.lat.percentile(99) > 0)
+        std::cout << "p99 no pool / pool: " << std::setprecision(2)
+                  << (double)direct.lat.percentile(99) / std::max<uint64_t>(1, pooled.lat.percentile(99))
+                  << "x (< 1: the pool thrashes, budget or free memory too small for the mix)\n";
+
+    if (!cfg.csv_path.empty()) {
+        std::ofstream csv(cfg.csv_path);
+        csv << std::fixed << std::setprecision(3)
+            << "path,ops,wall_sec,mean_ms,p50_ms,p99_ms,p999_ms,max_ms,failures,hits,misses,evictions,"
+               "create_ms,evict_ms,peak_mb\n";
+        for (auto* r : {&direct, &pooled}) {
+            const bool p = r == &pooled;
+            csv << r->name << "," << r->lat.count() << "," << r->wall_sec << "," << r->lat.mean() / 1e6 << ","
+                << r->lat.percentile(50) / 1e6 << "," << r->lat.percentile(99) / 1e6 << ","
+                << r->lat.percentile(99.9) / 1e6 << "," << r->lat.max() / 1e6 << "," << r->failures << ",";
+            if (p)
+                csv << st.hits << "," << st.misses << "," << st.evictions << "," << st.create_ns / 1e6 << ","
+                    << st.evict_ns / 1e6 << "," << st.peak_bytes / 1048576.0;
+            else
+                csv << ",,,,,";
+            csv << "\n";
+        }
+    }
+    return 0;
+}
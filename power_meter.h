@@ -0,0 +1,110 @@
+#pragma once
+#include <algorithm>
+#include <string>
+
+#include "sysfs.h"
+#include "thermal_sampler.h"
+
+// ============================================================
+// Power meter (sysfs)
+//
+// 보드마다 전력 센서 위치가 달라 처음 찾은 것 하나를 사용:
+//   1) /sys/class/hwmon/hwmon*/power1_input          (uW)
+//   2) /sys/class/power_supply/*/power_now           (uW)
+//   3) /sys/class/power_supply/*/voltage_now × current_now  (uV × uA)
+// 없으면 read_w() = -1 → 결과표에 N/A.
+// ============================================================
+class PowerMeter
+{
+public:
+    explicit PowerMeter(const Sysfs& fs) : fs_(fs)
+    {
+        const std::string hw = "/sys/class/hwmon/";
+        for (auto& h : fs_.list_dir(hw, "hwmon")) {
+            if (fs_.read_ll(hw + h + "/power1_input") >= 0) {
+                power_ = hw + h + "/power1_input";
+                return;
+            }
+        }
+        const std::string ps = "/sys/class/power_supply/";
+        for (auto& p : fs_.list_dir(ps)) {
+            if (fs_.read_ll(ps + p + "/power_now") >= 0) {
+                power_ = ps + p + "/power_now";
+                return;
+            }
+        }
+        long long ua;
+        for (auto& p : fs_.list_dir(ps)) {
+            if (fs_.read_ll(ps + p + "/voltage_now") >= 0 &&
+                fs_.try_read_ll(ps + p + "/current_now", ua)) {     // 방전 중이면 음수
+                volt_ = ps + p + "/voltage_now";
+                curr_ = ps + p + "/current_now";
+                return;
+            }
+        }
+    }
+
+    bool available() const { return !power_.empty() || !volt_.empty(); }
+
+    std::string source() const
+    {
+        if (!power_.empty()) return power_;
+        if (!volt_.empty())  return volt_ + " x current_now";
+        return "N/A";
+    }
+
+    // 현재 전력 (W), 실패 시 -1
+    double read_w() const
+    {
+        if (!power_.empty()) {
+            long long uw = fs_.read_ll(power_);
+            return uw < 0 ? -1.0 : uw / 1e6;
+        }
+        if (!volt_.empty()) {
+            long long uv, ua;
+            if (!fs_.try_read_ll(volt_, uv) || uv < 0 || !fs_.try_read_ll(curr_, ua)) return -1.0;
+            return (double)uv * (double)(ua < 0 ? -ua : ua) / 1e12;
+        }
+        return -1.0;
+    }
+
+private:
+    Sysfs fs_;
+    std::string power_, volt_, curr_;
+};
+
+// ============================================================
+// 측정 구간 동안의 power / NPU 온도 누적
+//
+// add() 를 주기적으로 호출 → 평균 W, 온도 mean/max,
+// 온도 기울기 (최소자승, °C/min): 정상상태 도달 여부 판단용.
+// ============================================================
+struct PowerThermalWindow {
+    int    power_n = 0;
+    double power_sum = 0;
+    int    temp_n = 0;
+    double temp_max = 0;
+    double st = 0, sy = 0, stt = 0, sty = 0;   // slope 용 합
+
+    void add(double t_sec, double watts, const ThermalSnapshot& th)
+    {
+        if (watts >= 0) {
+            power_sum += watts;
+            power_n++;
+        }
+        if (th.has_temp()) {
+            const double y = th.temp_c();
+            temp_max = temp_n ? std::max(temp_max, y) : y;
+            temp_n++;
+            st += t_sec; sy += y; stt += t_sec * t_sec; sty += t_sec * y;
+        }
+    }
+
+    double power_w()   const { return power_n ? power_sum / power_n : -1.0; }
+    double temp_mean() const { return temp_n ? sy / temp_n : 0.0; }
+    double slope_c_per_min() const
+    {
+        const double d = temp_n * stt - st * st;
+        return (temp_n >= 2 && d > 0) ? (temp_n * sty - st * sy) / d * 60.0 : 0.0;
+    }
+};
@@ -0,0 +1,30 @@
+#pragma once
+#include <cstring>
+#include <fstream>
+#include <string>
+
+// ============================================================
+// 프로세스 메모리 (/proc/self/status)
+//   VmRSS : 현재 resident (dma-buf mmap 으로 touch 한 page 포함)
+//   VmHWM : peak resident. clear_refs 에 5 를 쓰면 현재 값으로 reset (Linux 4.0+)
+// ============================================================
+inline long proc_status_kb(const char* key)
+{
+    std::ifstream f("/proc/self/status");
+    std::string line;
+    const size_t n = std::strlen(key);
+    while (std::getline(f, line)) {
+        if (line.compare(0, n, key) == 0 && line.size() > n && line[n] == ':')
+            return std::atol(line.c_str() + n + 1);
+    }
+    return -1;
+}
+
+inline long rss_kb()      { return proc_status_kb("VmRSS"); }
+inline long peak_rss_kb() { return proc_status_kb("VmHWM"); }
+
+inline bool reset_peak_rss()
+{
+    std::ofstream f("/proc/self/clear_refs");
+    return static_cast<bool>(f << "5" << std::flush);
+}
@@ -0,0 +1,123 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <ctime>
+#include <iomanip>
+#include <ostream>
+#include <string>
+
+#include "bench_common.h"
+#include "bench_config.h"
+#include "latency_stats.h"
+#include "thread_placement.h"
+#include "workload.h"
+
+// ============================================================
+// RT control-loop jitter probe
+//
+// 로봇 제어 loop 흉내: clock_nanosleep(TIMER_ABSTIME) 로 고정 주기
+// (기본 1 kHz) 마다 깨어나 work_us 만큼 계산 후 다시 잠든다.
+//   wake latency : 실제 깨어난 시각 - 목표 시각
+//   overrun      : 계산 종료가 다음 주기 시작을 넘긴 cycle (histogram = 넘긴 시간)
+//                  이미 지난 주기 시작 시각은 모두 건너뛰고 (missed periods 로 셈)
+//                  계산 종료 이후 첫 주기 경계에서 다시 시작 → wake latency 는
+//                  항상 미래의 release 시각 기준 (catch-up 지연이 섞이지 않음)
+// NPU / CPU 부하 phase와 같이 돌려 제어 timing 영향을 본다.
+// total() = overrun 수 → timeline 에 overrun/s 로 기록.
+// ============================================================
+class RtProbeWorkload : public Workload
+{
+public:
+    explicit RtProbeWorkload(const RtProbeConfig& cfg) : cfg_(cfg) {}
+    ~RtProbeWorkload() override { stop(); }
+
+    std::string name() const override { return "rt_probe"; }
+    const char* unit() const override { return "overrun/s"; }
+
+    void start(bench_clock::time_point t0) override
+    {
+        stop();
+        wake_.reset();
+        over_.reset();
+        cycles_ = 0;
+        missed_ = 0;
+        overruns_.v.store(0);
+        running_.store(true);
+        threads_.emplace_back([this, t0] { loop(t0); });
+    }
+
+    double total() const override { return (double)overruns_.v.load(std::memory_order_relaxed); }
+
+    // stop() 이후에만 유효 (thread join 후 읽기)
+    const LatencyHistogram& wake_latency() const { return wake_; }
+    const LatencyHistogram& overrun_time() const { return over_; }
+    uint64_t cycles()   const { return cycles_; }
+    uint64_t overruns() const { return overruns_.v.load(); }
+    uint64_t missed()   const { return missed_; }
+
+    void report(std::ostream& os) const override
+    {
+        os << "  rt_probe (" << ThreadPlacement{cfg_.cpu, cfg_.rt_prio}.str() << ", "
+           << cfg_.hz << " Hz, work " << cfg_.work_us << " us): " << cycles_ << " cycles\n"
+           << "    wake latency : ";
+        wake_.print(os, 1e3, "us");
+        os << "\n    overruns     : " << overruns() << " ("
+           << std::fixed << std::setprecision(3)
+           << (cycles_ ? overruns() * 100.0 / cycles_ : 0.0) << "%), missed periods " << missed_;
+        if (over_.count()) {
+            os << "\n    overrun by   : ";
+            over_.print(os, 1e3, "us");
+        }
+        os << "\n";
+    }
+
+private:
+    static uint64_t mono_ns()
+    {
+        timespec ts{};
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+    }
+
+    void loop(bench_clock::time_point t0)
+    {
+        apply_placement({cfg_.cpu, cfg_.rt_prio}, "rt_probe");
+
+        // bench_clock(steady_clock) 와 CLOCK_MONOTONIC 은 같은 시계 (Linux libstdc++)
+        const uint64_t period = 1000000000ULL / (uint64_t)std::max(1, cfg_.hz);
+        const uint64_t work   = (uint64_t)cfg_.work_us * 1000;
+        uint64_t next = (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+                            t0.time_since_epoch()).count();
+
+        while (running_.load(std::memory_order_relaxed)) {
+            timespec ts{(time_t)(next / 1000000000ULL), (long)(next % 1000000000ULL)};
+            while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr) == EINTR) {}
+
+            const uint64_t woke = mono_ns();
+            wake_.add(woke > next ? woke - next : 0);
+            cycles_++;
+
+            uint64_t end = woke;
+            while (end - woke < work) end = mono_ns();
+
+            // 다음 release = deadline. overrun 이면 deadline 포함 end 이전의 경계는 모두
+            // 놓친 주기 (skip + 1 개) → end 이후 첫 경계 deadline + (skip + 1) * period 로
+            const uint64_t deadline = next + period;
+            next = deadline;
+            if (end > deadline) {
+                over_.add(end - deadline);
+                overruns_.v.fetch_add(1, std::memory_order_relaxed);
+                const uint64_t skip = (end - deadline) / period;
+                missed_ += skip + 1;
+                next = deadline + (skip + 1) * period;
+            }
+        }
+    }
+
+    RtProbeConfig    cfg_;
+    LatencyHistogram wake_, over_;
+    uint64_t         cycles_ = 0, missed_ = 0;
+    PaddedCounter    overruns_;
+};
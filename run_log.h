@@ -0,0 +1,120 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "npu_matmul.h"
+
+// ============================================================
+// --run-log: run 1회 = 1 row, file 로 streaming
+//
+// worker 마다 고정 크기 SPSC ring 에 push 하고, writer thread 가 100 ms 마다
+// 비워서 file 에 쓴다 → 몇 시간을 돌려도 memory 는 ring 크기로 고정.
+// ring 이 가득 차면 (writer 가 I/O 에 막힘) 그 sample 은 버리고 dropped 로 센다.
+// row 는 core 별 chunk 단위로 섞여 나오므로 순서가 필요하면 t_end_sec 로 정렬.
+// ============================================================
+class RunLogRing
+{
+public:
+    explicit RunLogRing(size_t capacity = 1 << 16) : buf_(capacity) {}
+
+    // worker thread 전용
+    void push(const RunSample& s)
+    {
+        const size_t h = head_.load(std::memory_order_relaxed);
+        if (h - tail_.load(std::memory_order_acquire) == buf_.size()) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        buf_[h % buf_.size()] = s;
+        head_.store(h + 1, std::memory_order_release);
+    }
+
+    // writer thread 전용. 쌓인 sample 마다 f(sample), 처리한 개수 반환
+    template <typename F>
+    size_t drain(F f)
+    {
+        const size_t t = tail_.load(std::memory_order_relaxed);
+        const size_t h = head_.load(std::memory_order_acquire);
+        for (size_t i = t; i < h; i++) f(buf_[i % buf_.size()]);
+        tail_.store(h, std::memory_order_release);
+        return h - t;
+    }
+
+    uint64_t dropped() const { return dropped_.load(); }
+
+private:
+    std::vector<RunSample> buf_;
+    alignas(64) std::atomic<size_t> head_{0};
+    alignas(64) std::atomic<size_t> tail_{0};
+    std::atomic<uint64_t> dropped_{0};
+};
+
+class RunLogWriter
+{
+public:
+    RunLogWriter(const std::string& path, int cores, uint64_t ops_per_run)
+        : out_(path), rings_(cores), ops_per_run_(ops_per_run)
+    {
+        out_ << "t_end_sec,core,run_us,gops,npu_temp_c,npu_freq_mhz,throttle_level,throttle_mask\n"
+             << std::fixed;
+    }
+    ~RunLogWriter() { stop(); }
+
+    bool ok() const { return (bool)out_; }
+    RunLogRing* ring(int core) { return &rings_[core]; }
+
+    void start()
+    {
+        running_.store(true);
+        thread_ = std::thread([this] {
+            while (running_.load()) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                flush();
+            }
+        });
+    }
+
+    // worker 가 모두 끝난 뒤 호출 → 남은 sample 까지 기록
+    void stop()
+    {
+        if (running_.exchange(false) && thread_.joinable()) thread_.join();
+        flush();
+        out_.flush();
+    }
+
+    uint64_t rows() const { return rows_; }
+    uint64_t dropped() const
+    {
+        uint64_t d = 0;
+        for (auto& r : rings_) d += r.dropped();
+        return d;
+    }
+
+private:
+    void flush()
+    {
+        for (int i = 0; i < (int)rings_.size(); i++) {
+            rows_ += rings_[i].drain([&](const RunSample& r) {
+                out_ << std::setprecision(6) << r.t_end_ns / 1e9 << "," << i
+                     << "," << std::setprecision(1) << r.run_ns / 1e3
+                     << "," << (double)ops_per_run_ / r.run_ns << ",";
+                if (r.thermal.has_temp()) out_ << r.thermal.temp_c();
+                out_ << "," << std::setprecision(0) << r.thermal.freq_mhz()
+                     << "," << r.thermal.throttle_level << "," << r.thermal.throttle_mask << "\n";
+            });
+        }
+    }
+
+    std::ofstream out_;
+    std::vector<RunLogRing> rings_;
+    uint64_t ops_per_run_;
+    uint64_t rows_ = 0;
+    std::atomic<bool> running_{false};
+    std::thread thread_;
+};
@@ -131,9 +131,10 @@ fi
 if [[ "$MODE" == "npu" || "$MODE" == "both" ]]; then
     echo "[3] Starting NPU stress (MatMul ${MM_M}x${MM_K}x${MM_N})..."
     if [[ -x "${MATMUL_DIR}/bench" ]]; then
-        timeout "${DURATION_SEC}s" \
+        # bench 가 --duration 으로 스스로 종료 (summary 보장), timeout 은 안전장치
+        timeout "$((DURATION_SEC + 60))s" \
             taskset -c 4-7 "${MATMUL_DIR}/bench" \
-            "$MM_M" "$MM_K" "$MM_N" "$MM_CORE" \
+            "$MM_M" "$MM_K" "$MM_N" "$MM_CORE" --duration "${DURATION_SEC}" \
             > "${LOG_DIR}/npu_stress.log" 2>&1 &
         PID_NPU=$!
     else
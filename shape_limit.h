@@ -0,0 +1,177 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <malloc.h>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "bench_common.h"
+#include "bench_config.h"
+#include "data_gen.h"
+#include "npu_workload.h"
+#include "proc_mem.h"
+
+// ============================================================
+// Maxshape mode: type × core 수 별로 할당 가능한 최대 shape
+//
+// 4GB / 8GB board 에서 rknn_matmul_create / rknn_create_mem 이 어디서 실패하는지
+// 미리 알기 위해, 한 변수 s 로 shape 를 키우며 (--maxshape-grow)
+//   s = 64, 128, 256, ... 실패할 때까지 doubling → 64 단위 binary search
+// feasible = core 수만큼 context 가 모두 생성됨 (probe 는 zeros 로 채워 빠르게).
+// 찾은 한계 shape 에서 random data 로 --maxshape-sec 동안 GOPS 측정.
+// ============================================================
+struct ShapeLimit {
+    rknn_tensor_type type;
+    int cores;
+    int s = 0;                       // 0 = 최소 shape 도 실패
+    bool capped = false;             // --maxshape-max 까지 성공
+    int m = 0, k = 0, n = 0;
+    uint64_t dma_bytes = 0;
+    long peak_rss_kb = 0;
+    double gops = 0;
+    int probes = 0;
+    double search_sec = 0;
+};
+
+// s → (M, K, N). grow: all (M=K=N=s) | m | k | n | kn, 나머지는 positional shape
+inline bool grow_shape(const std::string& grow, int s, const BenchConfig& cfg, int& m, int& k, int& n)
+{
+    m = cfg.M; k = cfg.K; n = cfg.N;
+    if (grow == "all")     m = k = n = s;
+    else if (grow == "m")  m = s;
+    else if (grow == "k")  k = s;
+    else if (grow == "n")  n = s;
+    else if (grow == "kn") k = n = s;
+    else return false;
+    return true;
+}
+
+inline int run_max_shape(const BenchConfig& cfg, std::atomic<bool>& running)
+{
+    constexpr int STEP = 64;         // INT8 / FP16 모두 K, N 정렬 조건을 만족
+    const int cap = std::max(STEP, cfg.maxshape_max / STEP * STEP);
+    int m, k, n;
+    if (!grow_shape(cfg.maxshape_grow, STEP, cfg, m, k, n)) {
+        std::cerr << "Unknown --maxshape-grow: " << cfg.maxshape_grow << " (all|m|k|n|kn)" << std::endl;
+        return 1;
+    }
+    std::vector<rknn_tensor_type> types;
+    for (auto& t : parse_name_list(cfg.maxshape_types)) {
+        if (t == "int8")      types.push_back(RKNN_TENSOR_INT8);
+        else if (t == "fp16") types.push_back(RKNN_TENSOR_FLOAT16);
+        else {
+            std::cerr << "Unknown type: " << t << " (int8|fp16)" << std::endl;
+            return 1;
+        }
+    }
+
+    std::cout << "Max shape search: grow " << cfg.maxshape_grow << " (M K N base " << cfg.M << " " << cfg.K
+              << " " << cfg.N << "), s <= " << cap << ", step " << STEP << ", cores {"
+              << cfg.maxshape_cores << "}, " << cfg.maxshape_sec << " s at the limit\n"
+              << "(init failure messages during the search are expected)\n";
+
+    const datagen::DataParams saved = datagen::params();
+    std::vector<ShapeLimit> res;
+    for (rknn_tensor_type type : types) {
+        for (int cores : parse_int_list(cfg.maxshape_cores)) {
+            if (!running.load()) break;
+            if (cores < 1 || cores > 3) continue;
+            ShapeLimit r{type, cores};
+            const auto t_search = bench_clock::now();
+
+            // context 생성만 (warm-up run 없음: 큰 shape 는 run 1회가 수 초)
+            auto feasible = [&](int s) {
+                grow_shape(cfg.maxshape_grow, s, cfg, m, k, n);
+                r.probes++;
+                std::vector<std::unique_ptr<RKNNMatMul>> ctxs;
+                bool ok = true;
+                for (int c = 0; c < cores && ok; c++) {
+                    ctxs.push_back(std::make_unique<RKNNMatMul>(m, k, n, type, 1, 1, CORE_MASKS[c]));
+                    ok = ctxs.back()->valid;
+                }
+                return ok;
+            };
+
+            // probe 는 data 내용이 상관없으므로 zeros (memset) 로 채움
+            datagen::params().pattern_a.kind = datagen::DataPattern::Zeros;
+            datagen::params().pattern_b.kind = datagen::DataPattern::Zeros;
+            int lo = 0, hi = 0;
+            for (int s = STEP; running.load(); s *= 2) {
+                if (s > cap) {
+                    if (lo < cap && feasible(cap)) lo = cap;
+                    else if (lo < cap)             hi = cap;
+                    break;
+                }
+                if (!feasible(s)) { hi = s; break; }
+                lo = s;
+            }
+            r.capped = hi == 0 && lo == cap;
+            while (hi - lo > STEP && running.load()) {
+                const int mid = (lo + hi) / 2 / STEP * STEP;
+                if (feasible(mid)) lo = mid;
+                else               hi = mid;
+            }
+            datagen::params() = saved;
+            r.s = lo;
+            r.search_sec = elapsed_ns(t_search, bench_clock::now()) / 1e9;
+
+            if (r.s > 0 && running.load()) {
+                grow_shape(cfg.maxshape_grow, r.s, cfg, r.m, r.k, r.n);
+                malloc_trim(0);
+                reset_peak_rss();
+                NpuWorkload npu("limit", r.m, r.k, r.n, type, cores);
+                if (npu.prepare()) {
+                    r.dma_bytes = npu.dma_bytes();
+                    const auto t0 = bench_clock::now() + std::chrono::milliseconds(200);
+                    npu.start(t0);
+                    std::this_thread::sleep_until(t0);
+                    const auto t_end = t0 + std::chrono::seconds(cfg.maxshape_sec);
+                    while (bench_clock::now() < t_end && running.load())
+                        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                    const double sec = elapsed_ns(t0, std::min(bench_clock::now(), t_end)) / 1e9;
+                    r.gops = sec > 0 ? npu.total() / sec : 0.0;
+                    npu.stop();
+                    r.peak_rss_kb = peak_rss_kb();
+                }
+            }
+            std::cout << "\n▶ " << type_name(type) << " x" << cores << ": s=" << r.s
+                      << (r.capped ? " (cap)" : "") << ", " << r.m << "x" << r.k << "x" << r.n << ", "
+                      << std::fixed << std::setprecision(1) << r.gops << " GOPS, " << r.probes
+                      << " probes" << std::endl;
+            res.push_back(r);
+        }
+    }
+    datagen::params() = saved;
+
+    std::cout << "\n═══ Max Shape Summary (grow " << cfg.maxshape_grow << ") ═══\n"
+              << std::left << std::setw(6) << "type" << std::right << std::setw(6) << "cores"
+              << std::setw(20) << "M x K x N" << std::setw(10) << "DMA MB" << std::setw(11) << "peak RSS"
+              << std::setw(10) << "GOPS" << std::setw(8) << "probes" << std::setw(10) << "search s" << "\n";
+    std::ofstream csv;
+    if (!cfg.csv_path.empty()) {
+        csv.open(cfg.csv_path);
+        csv << std::fixed << "type,cores,grow,s,capped,m,k,n,dma_bytes,peak_rss_kb,gops,probes,search_sec\n";
+    }
+    for (auto& r : res) {
+        const std::string shape = r.s ? std::to_string(r.m) + "x" + std::to_string(r.k) + "x" + std::to_string(r.n)
+                                      : std::string("none");
+        std::cout << std::left << std::setw(6) << type_name(r.type) << std::right << std::setw(6) << r.cores
+                  << std::setw(20) << (r.capped ? ">=" + shape : shape) << std::fixed << std::setprecision(1)
+                  << std::setw(10) << r.dma_bytes / 1048576.0 << std::setw(11) << r.peak_rss_kb / 1024.0
+                  << std::setw(10) << r.gops << std::setw(8) << r.probes << std::setw(10) << r.search_sec
+                  << "\n";
+        if (csv)
+            csv << type_name(r.type) << "," << r.cores << "," << cfg.maxshape_grow << "," << r.s << ","
+                << r.capped << "," << r.m << "," << r.k << "," << r.n << "," << r.dma_bytes << ","
+                << r.peak_rss_kb << "," << std::setprecision(2) << r.gops << "," << r.probes << ","
+                << r.search_sec << "\n";
+    }
+    std::cout << "(>= : still feasible at --maxshape-max; peak RSS is host VmHWM while running at the limit)\n";
+    return 0;
+}
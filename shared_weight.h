@@ -0,0 +1,108 @@
+#pragma once
+#include <atomic>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "bench_config.h"
+#include "npu_workload.h"
+#include "thermal_sampler.h"
+
+// ============================================================
+// Shared-B mode: core별 B (private) vs core 0 의 B 하나를 3 context 가 bind (shared)
+//
+// 배포 환경에서는 weight 1벌이 3 core 를 같이 serve 한다. 같은 DMA buffer 를
+// 세 core 가 동시에 읽을 때 (DDR bank 충돌 / cache 효과) throughput 이 변하는지,
+// B footprint 가 얼마나 줄어드는지를 본다.
+//   private → shared → private   (각 --phase-sec, 사이 2초 idle)
+// 마지막 private 는 온도 drift 확인용: 두 private 차이보다 shared 차이가 커야 의미 있음.
+// ============================================================
+struct SharedBPhase {
+    bool shared = false;
+    double gops = 0;
+    double core_gops[3] = {0, 0, 0};
+    LatencyHistogram lat;            // 3 core merge
+    double temp_mean = 0;
+    uint64_t dma_bytes = 0;
+};
+
+inline int run_shared_b_compare(const BenchConfig& cfg, ThermalSampler& sampler,
+                                std::atomic<bool>& running)
+{
+    std::cout << "Shared-B compare: " << cfg.M << "x" << cfg.K << "x" << cfg.N << " " << type_name(cfg.type)
+              << ", 3 cores, private → shared → private, " << cfg.phase_sec << " s each\n";
+
+    std::vector<SharedBPhase> phases;
+    for (bool shared : {false, true, false}) {
+        if (!running.load()) break;
+        if (!phases.empty()) std::this_thread::sleep_for(std::chrono::seconds(2));
+
+        NpuWorkload npu(shared ? "shared" : "private", cfg.M, cfg.K, cfg.N, cfg.type);
+        npu.set_shared_b(shared);
+        if (!npu.prepare()) return 1;
+
+        std::cout << "\n▶ " << (shared ? "shared B" : "private B") << std::endl;
+        const auto t0 = bench_clock::now() + std::chrono::milliseconds(200);
+        npu.start(t0);
+        std::this_thread::sleep_until(t0);
+
+        double temp_sum = 0;
+        int temp_n = 0;
+        const auto t_end = t0 + std::chrono::seconds(cfg.phase_sec);
+        auto t = t0;
+        while (t < t_end && running.load()) {
+            t += std::chrono::milliseconds(cfg.sample_ms);
+            std::this_thread::sleep_until(t);
+            const ThermalSnapshot snap = sampler.latest();
+            if (snap.has_temp()) {
+                temp_sum += snap.temp_c();
+                temp_n++;
+            }
+        }
+        const double sec = elapsed_ns(t0, std::min(t, t_end)) / 1e9;
+        npu.stop();
+
+        SharedBPhase ph;
+        ph.shared    = shared;
+        ph.gops      = sec > 0 ? npu.total() / sec : 0.0;
+        ph.temp_mean = temp_n ? temp_sum / temp_n : 0.0;
+        ph.dma_bytes = npu.dma_bytes();
+        for (int c = 0; c < 3; c++) {
+            ph.core_gops[c] = sec > 0 ? npu.core_runs(c) * (double)npu.ops_per_run() / 1e9 / sec : 0.0;
+            ph.lat.merge(npu.latency(c));
+        }
+        std::cout << std::fixed << std::setprecision(1) << "  " << ph.gops << " GOPS  ";
+        ph.lat.print(std::cout);
+        std::cout << std::endl;
+        phases.push_back(std::move(ph));
+    }
+    if (phases.size() < 2) return 0;
+
+    std::cout << "\n═══ Shared B Summary (" << cfg.M << "x" << cfg.K << "x" << cfg.N << " "
+              << type_name(cfg.type) << ") ═══\n"
+              << std::left << std::setw(10) << "B" << std::right << std::setw(10) << "GOPS"
+              << std::setw(8) << "core0" << std::setw(8) << "core1" << std::setw(8) << "core2"
+              << std::setw(10) << "p50 ms" << std::setw(10) << "p99 ms" << std::setw(9) << "T mean"
+              << std::setw(10) << "DMA MB" << "\n";
+    for (auto& p : phases) {
+        std::cout << std::left << std::setw(10) << (p.shared ? "shared" : "private") << std::right
+                  << std::fixed << std::setprecision(1) << std::setw(10) << p.gops
+                  << std::setw(8) << p.core_gops[0] << std::setw(8) << p.core_gops[1]
+                  << std::setw(8) << p.core_gops[2] << std::setprecision(3)
+                  << std::setw(10) << p.lat.percentile(50) / 1e6 << std::setw(10) << p.lat.percentile(99) / 1e6
+                  << std::setprecision(1) << std::setw(9) << p.temp_mean
+                  << std::setw(10) << p.dma_bytes / 1048576.0 << "\n";
+    }
+
+    // shared 를 앞뒤 private 평균과 비교, private 끼리의 차이는 drift (noise floor)
+    const double base = phases.size() > 2 ? (phases[0].gops + phases[2].gops) / 2 : phases[0].gops;
+    std::cout << std::showpos << std::setprecision(2)
+              << "shared vs private: " << (base > 0 ? (phases[1].gops / base - 1.0) * 100.0 : 0.0) << "% GOPS";
+    if (phases.size() > 2 && phases[0].gops > 0)
+        std::cout << " (private drift " << (phases[2].gops / phases[0].gops - 1.0) * 100.0 << "%)";
+    std::cout << std::noshowpos << ", B memory saved "
+              << std::setprecision(1) << (double)(phases[0].dma_bytes - phases[1].dma_bytes) / 1048576.0
+              << " MB\n";
+    return 0;
+}
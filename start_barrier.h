@@ -0,0 +1,67 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+#include "bench_common.h"
+
+// ============================================================
+// Start barrier: 모든 worker 가 context 생성 + warm-up 을 마친 뒤
+// 같은 시각 t0 (= 마지막 도착 + lead) 에 측정을 시작한다.
+// monitor 도 같은 t0 에서 1초 window 를 시작 → 초반 interval 에
+// 2-core / 3-core 구간이 섞이지 않는다.
+// init 실패한 worker 는 drop() 으로 빠진다.
+// ============================================================
+class StartBarrier
+{
+public:
+    explicit StartBarrier(int parties, std::chrono::milliseconds lead = std::chrono::milliseconds(50))
+        : waiting_(parties), lead_(lead) {}
+
+    // worker: 도착 후 t0 를 기다림. running 이 꺼지면 false
+    bool arrive(std::atomic<bool>& running, bench_clock::time_point& t0)
+    {
+        std::unique_lock<std::mutex> lk(mu_);
+        if (--waiting_ == 0) release_locked();
+        return wait_locked(lk, running, t0);
+    }
+
+    void drop()
+    {
+        std::lock_guard<std::mutex> lk(mu_);
+        if (--waiting_ == 0) release_locked();
+    }
+
+    // monitor / main: 도착하지 않고 t0 만 기다림
+    bool wait(std::atomic<bool>& running, bench_clock::time_point& t0)
+    {
+        std::unique_lock<std::mutex> lk(mu_);
+        return wait_locked(lk, running, t0);
+    }
+
+private:
+    void release_locked()
+    {
+        t0_ = bench_clock::now() + lead_;
+        released_ = true;
+        cv_.notify_all();
+    }
+
+    bool wait_locked(std::unique_lock<std::mutex>& lk, std::atomic<bool>& running,
+                     bench_clock::time_point& t0)
+    {
+        // Ctrl+C 는 notify 가 없으므로 주기적으로 확인
+        while (!released_ && running.load())
+            cv_.wait_for(lk, std::chrono::milliseconds(50));
+        t0 = t0_;
+        return released_ && running.load();
+    }
+
+    std::mutex mu_;
+    std::condition_variable cv_;
+    int  waiting_;
+    bool released_ = false;
+    bench_clock::time_point t0_{};
+    std::chrono::milliseconds lead_;
+};
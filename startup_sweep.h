@@ -0,0 +1,199 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <malloc.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "bench_common.h"
+#include "bench_config.h"
+#include "npu_matmul.h"
+#include "proc_mem.h"
+
+// ============================================================
+// Startup mode: matmul context 생성 비용 breakdown
+//
+// context 를 요청 시점에 만드는 서비스에서는 steady-state 만큼
+// 첫 결과까지의 시간이 중요하다. K × N 조합마다 startup_reps 번
+//   RKNNMatMul 생성 (StartupTimes 단계별) → 첫 run → 두 번째 run → 파괴
+// 를 NPU core 0 에서 반복하고 단계별 median 을 보고한다.
+// M 은 positional 로 지정한 값 (기본 1, on-demand 추론 형태).
+// ============================================================
+struct StartupSample {
+    int k, n;
+    StartupTimes t;
+    uint64_t second_run = 0, destroy = 0;
+    uint64_t bytes = 0;          // attr A + B + C
+};
+
+inline int run_startup_sweep(const BenchConfig& cfg, std::atomic<bool>& running)
+{
+    const int m = cfg.shape_set ? cfg.M : 1;
+    const std::vector<int> ks = parse_int_list(cfg.startup_k);
+    const std::vector<int> ns = parse_int_list(cfg.startup_n);
+
+    std::cout << "Startup sweep: M=" << m << " " << type_name(cfg.type) << ", K {" << cfg.startup_k
+              << "} x N {" << cfg.startup_n << "}, " << cfg.startup_reps << " reps (median)\n";
+
+    std::ofstream csv;
+    if (!cfg.csv_path.empty()) {
+        csv.open(cfg.csv_path);
+        csv << "k,n,rep,bytes,create_us,core_mask_us,mem_a_us,mem_b_us,mem_c_us,fill_us,copy_us,"
+               "set_io_us,init_us,first_run_us,second_run_us,destroy_us\n";
+    }
+
+    std::cout << "\n" << std::setw(6) << "K" << std::setw(6) << "N" << std::setw(9) << "MB"
+              << std::setw(9) << "create" << std::setw(7) << "mask" << std::setw(8) << "mem A"
+              << std::setw(8) << "mem B" << std::setw(8) << "mem C" << std::setw(9) << "fill"
+              << std::setw(8) << "copy" << std::setw(8) << "set_io" << std::setw(9) << "init"
+              << std::setw(9) << "1st run" << std::setw(9) << "2nd run" << std::setw(9) << "destroy"
+              << "   (us)\n";
+
+    for (int k : ks) {
+        for (int n : ns) {
+            if (!running.load()) return 0;
+            std::vector<StartupSample> reps;
+            for (int r = 0; r < cfg.startup_reps && running.load(); r++) {
+                StartupSample s{k, n, {}, 0, 0, 0};
+                auto mm = std::make_unique<RKNNMatMul>(m, k, n, cfg.type, 1, 1, CORE_MASKS[0]);
+                if (!mm->valid) {
+                    std::cerr << "  " << k << "x" << n << ": init failed" << std::endl;
+                    break;
+                }
+                mm->run();
+                const auto t1 = bench_clock::now();
+                mm->run();
+                const auto t2 = bench_clock::now();
+                s.t          = mm->startup;
+                s.second_run = elapsed_ns(t1, t2);
+                s.bytes      = (uint64_t)mm->attr.A.size + mm->attr.B.size + mm->attr.C.size;
+                mm.reset();
+                s.destroy    = elapsed_ns(t2, bench_clock::now());
+                reps.push_back(s);
+
+                if (csv) csv << k << "," << n << "," << r << "," << s.bytes << std::fixed
+                             << std::setprecision(1) << "," << s.t.create / 1e3 << ","
+                             << s.t.core_mask / 1e3 << "," << s.t.mem_a / 1e3 << ","
+                             << s.t.mem_b / 1e3 << "," << s.t.mem_c / 1e3 << ","
+                             << s.t.fill / 1e3 << "," << s.t.copy / 1e3 << ","
+                             << s.t.set_io / 1e3 << "," << s.t.init_total() / 1e3 << ","
+                             << s.t.first_run / 1e3 << "," << s.second_run / 1e3 << ","
+                             << s.destroy / 1e3 << "\n";
+            }
+            if (reps.empty()) continue;
+
+            auto med = [&reps](auto get) {
+                std::vector<uint64_t> v;
+                for (auto& s : reps) v.push_back(get(s));
+                return median_us(v);
+            };
+            std::cout << std::fixed << std::setw(6) << k << std::setw(6) << n
+                      << std::setw(9) << std::setprecision(2) << reps[0].bytes / 1048576.0
+                      << std::setprecision(0)
+                      << std::setw(9) << med([](const StartupSample& s) { return s.t.create; })
+                      << std::setw(7) << med([](const StartupSample& s) { return s.t.core_mask; })
+                      << std::setw(8) << med([](const StartupSample& s) { return s.t.mem_a; })
+                      << std::setw(8) << med([](const StartupSample& s) { return s.t.mem_b; })
+                      << std::setw(8) << med([](const StartupSample& s) { return s.t.mem_c; })
+                      << std::setw(9) << med([](const StartupSample& s) { return s.t.fill; })
+                      << std::setw(8) << med([](const StartupSample& s) { return s.t.copy; })
+                      << std::setw(8) << med([](const StartupSample& s) { return s.t.set_io; })
+                      << std::setw(9) << med([](const StartupSample& s) { return s.t.init_total(); })
+                      << std::setw(9) << med([](const StartupSample& s) { return s.t.first_run; })
+                      << std::setw(9) << med([](const StartupSample& s) { return s.second_run; })
+                      << std::setw(9) << med([](const StartupSample& s) { return s.destroy; })
+                      << std::endl;
+        }
+    }
+    return 0;
+}
+
+// ============================================================
+// Init mode: context 입력 초기화 경로 비교 (같은 shape, 3 core)
+//   direct : DMA buffer (virt_addr) 에 직접 생성 (기본)
+//   staged : host malloc → fill → memcpy → free (--staged-init, 이전 방식)
+// rep 마다 VmHWM 을 reset 하고 3-core context 를 순서대로 만든 뒤
+// init 시간, fill / copy 합, peak RSS 증가분 (VmHWM - 시작 VmRSS) 을 잰다.
+// direct 를 먼저 돌리므로 clear_refs 가 안 돼도 direct 값은 정확하다.
+// ============================================================
+struct InitSample {
+    uint64_t init = 0, fill = 0, copy = 0;
+    long peak_kb = 0, rss_kb = 0;    // 시작 대비 peak / 생성 직후 resident
+};
+
+inline int run_init_compare(const BenchConfig& cfg, std::atomic<bool>& running)
+{
+    const datagen::DataParams saved = datagen::params();
+    const bool peak_reset = reset_peak_rss();
+    std::cout << "Init compare: 3 x " << cfg.M << "x" << cfg.K << "x" << cfg.N << " " << type_name(cfg.type)
+              << ", " << cfg.startup_reps << " reps (median)\n";
+    if (!peak_reset)
+        std::cout << "  (/proc/self/clear_refs not writable: staged peak includes the direct run)\n";
+
+    uint64_t dma_bytes = 0;
+    std::vector<InitSample> res[2];
+    for (int staged = 0; staged < 2 && running.load(); staged++) {
+        datagen::params().staged_init = staged == 1;
+        for (int r = 0; r < cfg.startup_reps && running.load(); r++) {
+            malloc_trim(0);      // 이전 rep 의 free 된 heap 을 반환 → base 가 부풀지 않게
+            if (peak_reset) reset_peak_rss();
+            const long base = rss_kb();
+            InitSample s;
+            std::unique_ptr<RKNNMatMul> mm[3];
+            const auto t0 = bench_clock::now();
+            for (int c = 0; c < 3; c++)
+                mm[c] = std::make_unique<RKNNMatMul>(cfg.M, cfg.K, cfg.N, cfg.type, 1, 1, CORE_MASKS[c]);
+            s.init    = elapsed_ns(t0, bench_clock::now());
+            s.peak_kb = std::max(0L, peak_rss_kb() - base);
+            s.rss_kb  = std::max(0L, rss_kb() - base);
+            dma_bytes = 0;
+            for (auto& m : mm) {
+                if (!m->valid) {
+                    std::cerr << "  init failed" << std::endl;
+                    datagen::params() = saved;
+                    return 1;
+                }
+                s.fill += m->startup.fill;
+                s.copy += m->startup.copy;
+                dma_bytes += (uint64_t)m->attr.A.size + m->attr.B.size + m->attr.C.size;
+            }
+            res[staged].push_back(s);
+        }
+    }
+    datagen::params() = saved;
+    if (res[0].empty() || res[1].empty()) return 0;
+
+    auto med = [](const std::vector<InitSample>& v, auto get) {
+        std::vector<uint64_t> x;
+        for (auto& s : v) x.push_back((uint64_t)get(s));
+        return median_us(x);
+    };
+    auto row = [&](const char* name, const std::vector<InitSample>& v) {
+        std::cout << std::left << std::setw(8) << name << std::right << std::fixed << std::setprecision(1)
+                  << std::setw(10) << med(v, [](const InitSample& s) { return s.init; }) / 1e3
+                  << std::setw(10) << med(v, [](const InitSample& s) { return s.fill; }) / 1e3
+                  << std::setw(10) << med(v, [](const InitSample& s) { return s.copy; }) / 1e3
+                  << std::setw(12) << med(v, [](const InitSample& s) { return s.peak_kb * 1000; }) / 1024.0
+                  << std::setw(11) << med(v, [](const InitSample& s) { return s.rss_kb * 1000; }) / 1024.0
+                  << "\n";
+    };
+    std::cout << "\nDMA A+B+C total: " << std::setprecision(1) << std::fixed << dma_bytes / 1048576.0 << " MB\n"
+              << std::left << std::setw(8) << "path" << std::right << std::setw(10) << "init ms"
+              << std::setw(10) << "fill ms" << std::setw(10) << "copy ms" << std::setw(12) << "peak +MB"
+              << std::setw(11) << "RSS +MB" << "\n";
+    row("direct", res[0]);
+    row("staged", res[1]);
+
+    const double di = med(res[0], [](const InitSample& s) { return s.init; });
+    const double si = med(res[1], [](const InitSample& s) { return s.init; });
+    const double dp = med(res[0], [](const InitSample& s) { return s.peak_kb * 1000; }) / 1024.0;
+    const double sp = med(res[1], [](const InitSample& s) { return s.peak_kb * 1000; }) / 1024.0;
+    std::cout << "direct vs staged: init " << std::showpos << std::setprecision(1)
+              << (si > 0 ? (di / si - 1.0) * 100.0 : 0.0) << "%, peak RSS " << dp - sp << " MB"
+              << std::noshowpos << "\n";
+    return 0;
+}
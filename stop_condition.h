@@ -0,0 +1,87 @@
+#pragma once
+#include <cmath>
+#include <cstdint>
+#include <iomanip>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// ============================================================
+// Stress mode 종료 조건
+//   --duration SEC     측정 시간 (monitor 첫 interval 부터)
+//   --iterations N     core당 run 횟수 (worker 가 직접 멈춤)
+//   --until-ci PCT     평균 latency 95% CI 반폭 < PCT% 이면 종료
+//
+// latency CI 는 1초 interval 평균을 batch 로 본 batch means
+// (run 단위 latency 는 자기상관이 커서 iid CI 가 지나치게 좁다).
+// 최소 10 interval 이 모여야 판정한다.
+// ============================================================
+class StopCondition
+{
+public:
+    StopCondition(int duration_sec, double until_ci_pct)
+        : duration_(duration_sec), ci_pct_(until_ci_pct) {}
+
+    // interval 평균 run latency (ns) 를 batch 로 추가
+    void add_interval(double mean_run_ns)
+    {
+        if (mean_run_ns > 0) batches_.push_back(mean_run_ns);
+    }
+
+    // 만족한 조건이 있으면 reason 을 기록하고 true
+    bool check(double elapsed_sec)
+    {
+        if (!reason_.empty()) return true;
+        if (duration_ > 0 && elapsed_sec >= duration_)
+            reason_ = "duration " + std::to_string(duration_) + "s";
+        else if (ci_pct_ > 0 && batches_.size() >= 10 && ci_half_pct() < ci_pct_)
+            reason_ = "latency CI";
+        return !reason_.empty();
+    }
+
+    // 외부 요인 (steady state, iterations, signal) 으로 멈출 때
+    void set_reason(const std::string& r) { if (reason_.empty()) reason_ = r; }
+    const std::string& reason() const { return reason_; }
+
+    double mean_ns() const
+    {
+        double s = 0;
+        for (double b : batches_) s += b;
+        return batches_.empty() ? 0.0 : s / batches_.size();
+    }
+
+    // 95% CI 반폭 / 평균 (%)
+    double ci_half_pct() const
+    {
+        const size_t n = batches_.size();
+        if (n < 2) return 100.0;
+        const double m = mean_ns();
+        double var = 0;
+        for (double b : batches_) var += (b - m) * (b - m);
+        var /= n - 1;
+        return m > 0 ? t95(n - 1) * std::sqrt(var / n) / m * 100.0 : 100.0;
+    }
+
+    void report(std::ostream& os) const
+    {
+        os << "Stopped by: " << (reason_.empty() ? "signal" : reason_) << "\n"
+           << "Mean latency: " << std::fixed << std::setprecision(3) << mean_ns() / 1e6
+           << " ms ±" << std::setprecision(2) << ci_half_pct() << "% (95% CI, "
+           << batches_.size() << " x 1s batch means)\n";
+    }
+
+private:
+    // Student t 0.975 quantile (df 30 초과는 정규 근사)
+    static double t95(size_t df)
+    {
+        static const double t[] = {12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+                                   2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+                                   2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042};
+        return df == 0 ? 0.0 : df <= 30 ? t[df - 1] : 1.960;
+    }
+
+    int    duration_;
+    double ci_pct_;
+    std::vector<double> batches_;
+    std::string reason_;
+};
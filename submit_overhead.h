@@ -0,0 +1,133 @@
+#pragma once
+#include <atomic>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "bench_config.h"
+#include "latency_stats.h"
+#include "npu_matmul.h"
+#include "placement_compare.h"
+#include "thread_cpu.h"
+#include "thread_placement.h"
+
+// ============================================================
+// Submit mode: rknn_matmul_run 호출 오버헤드 상한
+//
+// 작은 shape (기본 1x32x32) 은 MAC이 아니라 host + driver 비용이
+// 처리량을 결정한다. NPU core 1개 / 3개로 back-to-back 실행하며
+//   - 최대 runs/s
+//   - call당 host CPU time (CLOCK_THREAD_CPUTIME_ID)
+//   - wall 대비 user / kernel 비율 (RUSAGE_THREAD)
+//   - call당 context switch
+// 를 보고 → offload 할 가치가 있는 최소 layer 크기 판단 기준.
+// ============================================================
+struct SubmitResult {
+    int              cores = 0;
+    uint64_t         runs  = 0;
+    double           wall_s = 0;
+    ThreadCpuSample  cpu;          // 모든 thread 합
+    LatencyHistogram lat;
+};
+
+inline SubmitResult run_submit_case(const BenchConfig& cfg, int m, int k, int n,
+                                    int cores, std::atomic<bool>& running)
+{
+    SubmitResult res;
+    res.cores = cores;
+
+    const auto placements = worker_placements(cfg, !cfg.worker_cpus.empty(), cfg.rt_prio);
+    std::vector<std::unique_ptr<RKNNMatMul>> mms;
+    for (int i = 0; i < cores; i++) {
+        mms.emplace_back(new RKNNMatMul(m, k, n, cfg.type, 1, 1, CORE_MASKS[i]));
+        if (!mms.back()->valid) return res;
+        for (int w = 0; w < 100; w++) mms.back()->run();
+    }
+
+    // thread 별 결과. loop 안에서는 thread-local 로만 갱신하고 끝난 뒤 한 번 저장
+    // (인접 slot 을 매 call 쓰면 cache line 공유가 측정 대상인 call당 overhead 에 섞임)
+    std::vector<ThreadCpuSample>  cpu(cores);
+    std::vector<LatencyHistogram> lat(cores);
+    std::vector<uint64_t>         runs(cores, 0);
+
+    const auto t0 = bench_clock::now() + std::chrono::milliseconds(200);
+    const auto t1 = t0 + std::chrono::seconds(cfg.phase_sec);
+    std::vector<std::thread> th;
+    for (int i = 0; i < cores; i++) {
+        th.emplace_back([&, i] {
+            apply_placement(placements[i], "submit");
+            std::this_thread::sleep_until(t0);
+            RKNNMatMul& mm = *mms[i];
+            LatencyHistogram my_lat;
+            uint64_t my_runs = 0;
+            ThreadCpuSample c0 = thread_cpu_now();
+            auto t = bench_clock::now();
+            while (t < t1 && running.load(std::memory_order_relaxed)) {
+                mm.run();
+                auto e = bench_clock::now();
+                my_lat.add(elapsed_ns(t, e));
+                my_runs++;
+                t = e;
+            }
+            const ThreadCpuSample c = thread_cpu_now() - c0;
+            cpu[i]  = c;
+            lat[i]  = std::move(my_lat);
+            runs[i] = my_runs;
+        });
+    }
+    for (auto& t : th) t.join();
+
+    res.wall_s = elapsed_ns(t0, std::min(bench_clock::now(), t1)) / 1e9;
+    for (int i = 0; i < cores; i++) {
+        res.runs += runs[i];
+        res.cpu  += cpu[i];
+        res.lat.merge(lat[i]);
+    }
+    return res;
+}
+
+inline int run_submit_overhead(const BenchConfig& cfg, std::atomic<bool>& running)
+{
+    const int m = cfg.shape_set ? cfg.M : 1;
+    const int k = cfg.shape_set ? cfg.K : 32;
+    const int n = cfg.shape_set ? cfg.N : 32;
+    const uint64_t ops = matmul_ops(m, k, n);
+
+    std::cout << "Submit overhead: " << m << "x" << k << "x" << n << " " << type_name(cfg.type)
+              << ", " << cfg.phase_sec << "s per case\n";
+
+    std::vector<SubmitResult> rs;
+    for (int cores : {1, 3}) {
+        if (!running.load()) break;
+        std::cout << "  running on " << cores << " NPU core(s)..." << std::endl;
+        SubmitResult r = run_submit_case(cfg, m, k, n, cores, running);
+        if (r.runs == 0) {
+            std::cerr << "  init failed / no runs" << std::endl;
+            return 1;
+        }
+        rs.push_back(r);
+    }
+
+    std::cout << "\n═══ Submit Overhead Summary ═══\n";
+    for (auto& r : rs) {
+        const double calls    = (double)r.runs;
+        const double thr_wall = r.wall_s * r.cores * 1e9;    // 모든 thread wall ns 합
+        std::cout << std::fixed
+                  << "\n[" << r.cores << " core" << (r.cores > 1 ? "s" : "") << "]\n"
+                  << "  max runs/s      : " << std::setprecision(0) << calls / r.wall_s
+                  << "  (" << std::setprecision(3) << calls / r.wall_s * ops / 1e9 << " GOPS)\n"
+                  << "  wall / call     : ";
+        r.lat.print(std::cout, 1e3, "us");
+        std::cout << "\n  host CPU / call : " << std::setprecision(2) << r.cpu.cpu_ns / calls / 1e3
+                  << " us  (user " << r.cpu.user_ns / calls / 1e3
+                  << " / kernel " << r.cpu.sys_ns / calls / 1e3 << " us)\n"
+                  << "  share of wall   : user " << std::setprecision(1) << r.cpu.user_ns / thr_wall * 100
+                  << "%  kernel " << r.cpu.sys_ns / thr_wall * 100
+                  << "%  off-CPU " << std::max(0.0, 100.0 - r.cpu.cpu_ns / thr_wall * 100) << "%\n"
+                  << "  ctx switch/call : voluntary " << std::setprecision(2) << r.cpu.nvcsw / calls
+                  << "  involuntary " << r.cpu.nivcsw / calls << "\n";
+    }
+    return 0;
+}
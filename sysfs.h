@@ -0,0 +1,121 @@
+#pragma once
+#include <algorithm>
+#include <cstdlib>
+#include <dirent.h>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+// ============================================================
+// sysfs access helpers
+//
+// 모든 경로는 root prefix 기준 (기본 "" = 실제 /sys).
+// --sysfs-root 로 fake tree를 지정하면 보드 없이 테스트 가능.
+// ============================================================
+struct Sysfs {
+    std::string root;
+
+    std::string path(const std::string& p) const { return root + p; }
+
+    bool read_string(const std::string& p, std::string& out) const
+    {
+        std::ifstream f(path(p));
+        if (!f) return false;
+        std::getline(f, out);
+        while (!out.empty() && (out.back() == '\n' || out.back() == ' '))
+            out.pop_back();
+        return true;
+    }
+
+    // 숫자 파일 읽기. 성공 여부를 값과 따로 돌려줌 → 음수도 정상 값 (current_now 등)
+    bool try_read_ll(const std::string& p, long long& out) const
+    {
+        std::string s;
+        if (!read_string(p, s) || s.empty()) return false;
+        char* end = nullptr;
+        const long long v = std::strtoll(s.c_str(), &end, 10);
+        if (end == s.c_str()) return false;
+        out = v;
+        return true;
+    }
+
+    // 숫자 파일 (temp, cur_freq, cur_state ...) 읽기. 실패 시 fallback.
+    long long read_ll(const std::string& p, long long fallback = -1) const
+    {
+        long long v;
+        return try_read_ll(p, v) ? v : fallback;
+    }
+
+    bool write_string(const std::string& p, const std::string& v) const
+    {
+        std::ofstream f(path(p));
+        if (!f) return false;
+        f << v << std::flush;
+        return (bool)f;
+    }
+
+    // dir 안에서 prefix로 시작하는 항목 이름 목록.
+    // thermal_zone10 이 thermal_zone2 뒤에 오도록 숫자 suffix 기준 정렬.
+    std::vector<std::string> list_dir(const std::string& dir,
+                                      const std::string& prefix = "") const
+    {
+        std::vector<std::string> names;
+        DIR* d = opendir(path(dir).c_str());
+        if (!d) return names;
+        while (dirent* e = readdir(d)) {
+            std::string n = e->d_name;
+            if (n == "." || n == "..") continue;
+            if (n.compare(0, prefix.size(), prefix) == 0) names.push_back(n);
+        }
+        closedir(d);
+        auto suffix = [&](const std::string& n) {
+            return std::atol(n.c_str() + prefix.size());
+        };
+        std::sort(names.begin(), names.end(),
+                  [&](const std::string& a, const std::string& b) {
+                      long sa = suffix(a), sb = suffix(b);
+                      return sa != sb ? sa < sb : a < b;
+                  });
+        return names;
+    }
+};
+
+// ============================================================
+// 변경한 sysfs 값을 원래대로 되돌리는 guard
+//
+// set() 은 처음 건드리는 경로의 원래 값을 기억해 두고,
+// restore() / 소멸자에서 역순으로 다시 쓴다 (Ctrl+C 포함).
+// ============================================================
+class SysfsRestore
+{
+public:
+    explicit SysfsRestore(const Sysfs& fs) : fs_(fs) {}
+    ~SysfsRestore() { restore(); }
+
+    SysfsRestore(const SysfsRestore&) = delete;
+    SysfsRestore& operator=(const SysfsRestore&) = delete;
+
+    bool set(const std::string& p, const std::string& v)
+    {
+        bool known = false;
+        for (auto& s : saved_) known |= (s.first == p);
+        if (!known) {
+            std::string old;
+            if (!fs_.read_string(p, old)) return false;
+            saved_.emplace_back(p, old);
+        }
+        return fs_.write_string(p, v);
+    }
+
+    void restore()
+    {
+        for (auto it = saved_.rbegin(); it != saved_.rend(); ++it)
+            fs_.write_string(it->first, it->second);
+        saved_.clear();
+    }
+
+private:
+    Sysfs fs_;
+    std::vector<std::pair<std::string, std::string>> saved_;
+};
@@ -0,0 +1,222 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <iomanip>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "sysfs.h"
+
+// ============================================================
+// Time-to-throttle forecaster + thermal steady-state detector
+//
+// 1초마다 (t, NPU 온도, interval GOPS, throttle 여부) 를 넣는다.
+//
+// forecast: 최근 window 를 3등분한 평균 A, B, C 로 1차 지수 응답
+//   T(t) = T_inf - (T_inf - T0)·e^(-t/tau) 를 맞춘다 (평균이라 양자화에 강함).
+//     r = (C-B)/(B-A) = e^(-h/tau),  T_inf = (A·C - B²)/(A + C - 2B)
+//   ETA = tau · ln((T_inf - T)/(T_inf - trip))   (T_inf <= trip 이면 throttle 없음)
+//   감속 중이 아니면 (r >= 1) 선형 기울기로 ETA (기울기 < steady 기준이면 예상 없음).
+//
+// steady: window 가 찼고 |온도 기울기| < slope 기준 이고
+//   GOPS 95% CI (10 batch means, t=2.262) 반폭 / 평균 < ci 기준.
+// ============================================================
+struct ThrottleForecast {
+    bool   valid = false;
+    bool   exponential = false;  // false = 선형 외삽
+    double t_inf = 0, tau = 0;
+    double eta_sec = -1;         // 지금부터 throttle 까지, -1 = 예상 안 됨
+    double slope_c_per_min = 0;
+};
+
+// NPU zone 의 첫 passive trip point (°C), 없으면 fallback
+inline double npu_trip_c(const Sysfs& fs, const std::string& zone, double fallback = 85.0)
+{
+    if (zone.empty()) return fallback;
+    for (int i = 0; i < 8; i++) {
+        std::string type;
+        const std::string p = zone + "/trip_point_" + std::to_string(i);
+        if (!fs.read_string(p + "_type", type)) break;
+        if (type == "passive") {
+            long long mc = fs.read_ll(p + "_temp");
+            if (mc > 0) return mc / 1000.0;
+        }
+    }
+    return fallback;
+}
+
+class ThermalForecaster
+{
+public:
+    ThermalForecaster(double trip_c, int window_sec = 120,
+                      double ci_pct = 1.0, double slope_c_per_min = 0.2)
+        : trip_c_(trip_c), window_(std::max(30, window_sec)),
+          ci_pct_(ci_pct), slope_thr_(slope_c_per_min) {}
+
+    void add(double t_sec, double temp_c, double gops, bool throttled)
+    {
+        win_.push_back({t_sec, temp_c, gops});
+        while ((int)win_.size() > window_) win_.pop_front();
+
+        if (throttled && first_throttle_ < 0) {
+            first_throttle_ = t_sec;
+            // 60초 전에 내놓았던 예측과 비교
+            for (auto it = history_.rbegin(); it != history_.rend(); ++it) {
+                if (it->first <= t_sec - 60) {
+                    predicted_60s_ = it->second;
+                    break;
+                }
+            }
+        }
+        if (first_throttle_ < 0) {
+            ThrottleForecast f = forecast();
+            if (f.valid && f.eta_sec >= 0) history_.push_back({t_sec, t_sec + f.eta_sec});
+        }
+    }
+
+    ThrottleForecast forecast() const
+    {
+        ThrottleForecast f;
+        const int n = (int)win_.size();
+        if (n < 20) return f;
+        f.valid = true;
+        f.slope_c_per_min = slope() * 60.0;
+        const double t_now = win_.back().temp;
+
+        const int h = n / 3;
+        const double A = mean_temp(0, h), B = mean_temp(h, 2 * h), C = mean_temp(2 * h, 3 * h);
+        const double d1 = B - A, d2 = C - B;
+        if (d1 > 0.05 && d2 >= 0 && d2 < d1) {
+            const double r = std::max(1e-3, d2 / d1);
+            const double hs = win_[h].t - win_[0].t;
+            f.exponential = true;
+            f.tau   = -hs / std::log(r);
+            f.t_inf = (A * C - B * B) / (A + C - 2 * B);
+            if (f.t_inf > trip_c_ && t_now < trip_c_)
+                f.eta_sec = f.tau * std::log((f.t_inf - t_now) / (f.t_inf - trip_c_));
+            else if (t_now >= trip_c_)
+                f.eta_sec = 0;
+        } else if (f.slope_c_per_min > slope_thr_) {   // 평탄하면 noise 외삽 안 함
+            f.eta_sec = std::max(0.0, (trip_c_ - t_now) / (f.slope_c_per_min / 60.0));
+        }
+        return f;
+    }
+
+    bool steady() const
+    {
+        if ((int)win_.size() < window_) return false;
+        return std::fabs(slope() * 60.0) < slope_thr_ && gops_ci_pct() < ci_pct_;
+    }
+
+    double steady_gops() const { return batch_stats().first; }
+    double steady_temp() const { return mean_temp(0, (int)win_.size()); }
+
+    // GOPS 95% CI 반폭 (평균 대비 %)
+    double gops_ci_pct() const
+    {
+        auto s = batch_stats();
+        return s.first > 0 ? s.second / s.first * 100.0 : 100.0;
+    }
+
+    double trip_c() const { return trip_c_; }
+    double first_throttle_sec() const { return first_throttle_; }
+
+    // 한 줄 상태 (monitor 출력용)
+    void print_status(std::ostream& os) const
+    {
+        ThrottleForecast f = forecast();
+        os << std::fixed << std::setprecision(1) << "  FCAST : trip " << trip_c_ << "°C";
+        if (first_throttle_ >= 0) os << ", throttled at " << std::setprecision(0) << first_throttle_ << "s";
+        else if (!f.valid)        os << ", collecting";
+        else if (f.eta_sec < 0)   os << ", no throttle expected"
+                                     << (f.exponential ? " (T_inf " : "")
+                                     << (f.exponential ? std::to_string((int)std::lround(f.t_inf)) + "°C)" : "");
+        else if (f.eta_sec == 0)  os << ", at/above trip, no cooling yet";
+        else                      os << ", throttle in ~" << std::setprecision(0) << f.eta_sec << "s";
+        if (f.valid) os << std::setprecision(2) << "  slope " << f.slope_c_per_min << "°C/min";
+        if (f.exponential) os << std::setprecision(0) << "  tau " << f.tau << "s";
+        os << "  GOPS CI ±" << std::setprecision(2) << gops_ci_pct() << "%"
+           << (steady() ? "  STEADY" : "") << "\n";
+    }
+
+    void report(std::ostream& os) const
+    {
+        ThrottleForecast f = forecast();
+        os << std::fixed << std::setprecision(1)
+           << "Thermal forecast (trip " << trip_c_ << "°C, window " << window_ << "s):\n";
+        if (win_.empty()) {
+            os << "  no samples\n";
+            return;
+        }
+        if (first_throttle_ >= 0) {
+            os << "  first throttle at " << first_throttle_ << "s";
+            if (predicted_60s_ > 0)
+                os << " (forecast 60s before: " << predicted_60s_ << "s, error "
+                   << std::showpos << predicted_60s_ - first_throttle_ << std::noshowpos << "s)";
+            os << "\n";
+        } else if (f.valid) {
+            os << "  no throttle during run";
+            if (f.eta_sec >= 0) os << ", forecast ~" << f.eta_sec << "s after stop";
+            else if (f.exponential) os << ", T_inf " << f.t_inf << "°C < trip";
+            os << "\n";
+        }
+        if (f.exponential) os << "  fit: T_inf " << f.t_inf << "°C, tau " << f.tau << "s\n";
+        os << "  steady: " << (steady() ? "yes" : "no")
+           << ", GOPS " << steady_gops() << " ±" << std::setprecision(2) << gops_ci_pct() << "%"
+           << ", NPU " << std::setprecision(1) << steady_temp() << "°C"
+           << ", slope " << std::setprecision(2) << f.slope_c_per_min << "°C/min (last "
+           << win_.size() << "s)\n";
+    }
+
+private:
+    struct Sample { double t, temp, gops; };
+
+    double mean_temp(int a, int b) const
+    {
+        double s = 0;
+        for (int i = a; i < b; i++) s += win_[i].temp;
+        return b > a ? s / (b - a) : 0.0;
+    }
+
+    // 최소자승 기울기 (°C/s)
+    double slope() const
+    {
+        const int n = (int)win_.size();
+        if (n < 2) return 0.0;
+        double st = 0, sy = 0, stt = 0, sty = 0;
+        for (auto& s : win_) {
+            st += s.t; sy += s.temp; stt += s.t * s.t; sty += s.t * s.temp;
+        }
+        const double d = n * stt - st * st;
+        return d > 0 ? (n * sty - st * sy) / d : 0.0;
+    }
+
+    // (mean, 95% CI 반폭) — 10 batch means 로 자기상관 완화
+    std::pair<double, double> batch_stats() const
+    {
+        constexpr int NB = 10;
+        const int n = (int)win_.size(), bs = n / NB;
+        if (bs < 1) return {0.0, 0.0};
+        double m[NB], mean = 0;
+        for (int b = 0; b < NB; b++) {
+            double s = 0;
+            for (int i = b * bs; i < (b + 1) * bs; i++) s += win_[i].gops;
+            m[b] = s / bs;
+            mean += m[b] / NB;
+        }
+        double var = 0;
+        for (double x : m) var += (x - mean) * (x - mean);
+        var /= NB - 1;
+        return {mean, 2.262 * std::sqrt(var / NB)};
+    }
+
+    double trip_c_;
+    int    window_;
+    double ci_pct_, slope_thr_;
+    std::deque<Sample> win_;
+    std::vector<std::pair<double, double>> history_;   // (t, 예측 throttle 시각)
+    double first_throttle_ = -1;
+    double predicted_60s_ = -1;
+};
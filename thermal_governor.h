@@ -0,0 +1,206 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "bench_config.h"
+#include "npu_workload.h"
+#include "thermal_sampler.h"
+
+// ============================================================
+// Governor mode: 온도 상한 아래에서 GOPS 최대화
+//
+// throttle 점에 부딪혀 튕기는 대신 NPU 온도를 target 바로 아래에
+// 유지하도록 core별 issue duty 를 PID 로 조절한다.
+//   e    = target - T                  (양수 = 여유 있음)
+//   I   += Ki · e · dt                  (0..1 clamp, anti-windup)
+//   duty = clamp(Kp · e + I - Kd · dT/dt, min, 1)
+// 같은 shape 으로 uncontrolled (duty 1) phase 와 비교:
+//   sustained GOPS, 후반부 GOPS, 온도, target 초과 시간, throttle 횟수
+// throttle event = cooling device 동작 또는 devfreq < max_freq 로 바뀐 순간
+// ============================================================
+class PidController
+{
+public:
+    PidController(double kp, double ki, double kd, double out_min, double out_max)
+        : kp_(kp), ki_(ki), kd_(kd), min_(out_min), max_(out_max), i_(out_max) {}
+
+    double update(double err, double dmeas_dt, double dt)
+    {
+        i_ = std::min(max_, std::max(min_, i_ + ki_ * err * dt));
+        return std::min(max_, std::max(min_, kp_ * err + i_ - kd_ * dmeas_dt));
+    }
+
+private:
+    double kp_, ki_, kd_, min_, max_;
+    double i_;        // 처음에는 full duty 에서 시작
+};
+
+struct GovernorPhase {
+    std::string label;
+    double seconds = 0;
+    double gops = 0, gops_late = 0;      // 전체 / 후반 50%
+    double temp_mean = 0, temp_max = 0;
+    double above_frac = 0;               // T > target 비율
+    double throttle_frac = 0;
+    int    throttle_events = 0;
+    double duty_mean = 1.0;
+};
+
+inline GovernorPhase run_governor_phase(const BenchConfig& cfg, ThermalSampler& sampler,
+                                        std::atomic<bool>& running, NpuWorkload& npu,
+                                        bool controlled, long long max_freq, std::ofstream* csv)
+{
+    GovernorPhase r;
+    r.label = controlled ? "governed" : "uncontrolled";
+    PidController pid(cfg.gov_kp, cfg.gov_ki, cfg.gov_kd, cfg.gov_min_duty, 1.0);
+    npu.set_duty(1.0);
+
+    std::cout << "\n▶ " << r.label << " " << cfg.phase_sec << "s";
+    if (controlled) std::cout << "  (target " << cfg.gov_target_c << "°C)";
+    std::cout << std::endl;
+
+    const auto t0 = bench_clock::now() + std::chrono::milliseconds(200);
+    const auto t_end  = t0 + std::chrono::seconds(cfg.phase_sec);
+    const auto t_half = t0 + std::chrono::milliseconds(cfg.phase_sec * 500);
+    npu.start(t0);
+    std::this_thread::sleep_until(t0);
+
+    const double dt = cfg.gov_period_ms / 1000.0;
+    double prev_temp = -1, duty_sum = 0, temp_sum = 0, half_gop = -1;
+    int n = 0, temp_n = 0, above = 0, thr_n = 0;
+    bool prev_thr = false;
+    double prev_total = 0;
+    int last_print = 0;
+
+    auto t = t0;
+    while (t < t_end && running.load()) {
+        t += std::chrono::milliseconds(cfg.gov_period_ms);
+        std::this_thread::sleep_until(t);
+        const double t_sec = elapsed_ns(t0, t) / 1e9;
+        if (half_gop < 0 && t >= t_half) half_gop = npu.total();
+
+        ThermalSnapshot th = sampler.latest();
+        const bool thr = th.throttled() || (max_freq > 0 && th.npu_freq_hz > 0 && th.npu_freq_hz < max_freq);
+        if (thr) thr_n++;
+        if (thr && !prev_thr) r.throttle_events++;
+        prev_thr = thr;
+        n++;
+
+        double duty = 1.0;
+        if (th.has_temp()) {
+            const double temp = th.temp_c();
+            temp_sum += temp;
+            temp_n++;
+            r.temp_max = std::max(r.temp_max, temp);
+            if (temp > cfg.gov_target_c) above++;
+            if (controlled) {
+                const double dtemp = prev_temp < 0 ? 0.0 : (temp - prev_temp) / dt;
+                duty = pid.update(cfg.gov_target_c - temp, dtemp, dt);
+                npu.set_duty(duty);
+            }
+            prev_temp = temp;
+        }
+        duty_sum += npu.duty();
+
+        const double total = npu.total();
+        if (csv) *csv << r.label << "," << std::fixed << std::setprecision(2) << t_sec << ","
+                      << (th.has_temp() ? th.temp_c() : 0.0) << "," << std::setprecision(3)
+                      << npu.duty() << "," << std::setprecision(1) << (total - prev_total) / dt
+                      << "," << std::setprecision(0) << th.freq_mhz() << "," << thr << "\n";
+        prev_total = total;
+
+        if ((int)t_sec > last_print) {
+            last_print = (int)t_sec;
+            std::cout << "  [" << r.label << " " << std::setw(4) << last_print << "s]  duty "
+                      << std::fixed << std::setprecision(2) << npu.duty();
+            if (th.has_temp()) std::cout << "  NPU " << std::setprecision(1) << th.temp_c() << "°C";
+            if (thr) std::cout << "  THROTTLE " << sampler.throttle_str(th);
+            std::cout << "\n";
+        }
+    }
+
+    r.seconds = elapsed_ns(t0, std::min(t, t_end)) / 1e9;
+    const double gop = npu.total();
+    npu.stop();
+    npu.set_duty(1.0);
+
+    r.gops          = r.seconds > 0 ? gop / r.seconds : 0.0;
+    if (half_gop >= 0 && r.seconds > cfg.phase_sec / 2.0)
+        r.gops_late = (gop - half_gop) / (r.seconds - cfg.phase_sec / 2.0);
+    r.temp_mean     = temp_n ? temp_sum / temp_n : 0.0;
+    r.above_frac    = temp_n ? (double)above / temp_n : 0.0;
+    r.throttle_frac = n ? (double)thr_n / n : 0.0;
+    r.duty_mean     = n ? duty_sum / n : 1.0;
+    return r;
+}
+
+inline int run_thermal_governor(const BenchConfig& cfg, ThermalSampler& sampler,
+                                std::atomic<bool>& running)
+{
+    if (sampler.npu_zone().empty()) {
+        std::cerr << "NPU thermal zone not found (governor needs temperature)" << std::endl;
+        return 1;
+    }
+    const long long max_freq = sampler.npu_devfreq().empty()
+        ? -1 : cfg.sysfs.read_ll(sampler.npu_devfreq() + "/max_freq");
+
+    NpuWorkload npu("npu", cfg.M, cfg.K, cfg.N, cfg.type);
+    std::cout << "Preparing NPU contexts..." << std::endl;
+    if (!npu.prepare()) return 1;
+
+    std::ofstream csv;
+    if (!cfg.csv_path.empty()) {
+        csv.open(cfg.csv_path);
+        csv << "phase,t_sec,npu_temp_c,duty,gops,npu_freq_mhz,throttled\n";
+    }
+
+    std::vector<GovernorPhase> res;
+    for (bool controlled : {false, true}) {
+        if (!running.load()) break;
+        if (controlled && cfg.gov_cooldown_sec > 0) {
+            std::cout << "\nCooldown " << cfg.gov_cooldown_sec << "s..." << std::endl;
+            for (int s = 0; s < cfg.gov_cooldown_sec && running.load(); s++)
+                std::this_thread::sleep_for(std::chrono::seconds(1));
+        }
+        res.push_back(run_governor_phase(cfg, sampler, running, npu, controlled, max_freq,
+                                         csv.is_open() ? &csv : nullptr));
+    }
+
+    std::cout << "\n═══ Thermal Governor Summary ═══\n"
+              << cfg.M << "x" << cfg.K << "x" << cfg.N << " " << type_name(cfg.type)
+              << ", target " << std::fixed << std::setprecision(1) << cfg.gov_target_c
+              << "°C, PID " << std::setprecision(3) << cfg.gov_kp << "/" << cfg.gov_ki
+              << "/" << cfg.gov_kd << ", " << cfg.gov_period_ms << " ms\n\n"
+              << std::left << std::setw(14) << "phase" << std::right
+              << std::setw(8) << "sec" << std::setw(10) << "GOPS" << std::setw(12) << "late GOPS"
+              << std::setw(8) << "duty" << std::setw(9) << "T mean" << std::setw(8) << "T max"
+              << std::setw(9) << ">target" << std::setw(10) << "throttle" << std::setw(8) << "events"
+              << "\n";
+    for (auto& r : res) {
+        std::cout << std::left << std::setw(14) << r.label << std::right << std::fixed
+                  << std::setw(8) << std::setprecision(0) << r.seconds
+                  << std::setw(10) << std::setprecision(1) << r.gops
+                  << std::setw(12) << r.gops_late
+                  << std::setw(8) << std::setprecision(2) << r.duty_mean
+                  << std::setw(9) << std::setprecision(1) << r.temp_mean
+                  << std::setw(8) << r.temp_max
+                  << std::setw(8) << r.above_frac * 100.0 << "%"
+                  << std::setw(9) << r.throttle_frac * 100.0 << "%"
+                  << std::setw(8) << r.throttle_events << "\n";
+    }
+    if (res.size() == 2 && res[0].gops > 0) {
+        const double late0 = res[0].gops_late, late1 = res[1].gops_late;
+        std::cout << "\nGoverned vs uncontrolled: GOPS " << std::showpos << std::setprecision(1)
+                  << (res[1].gops / res[0].gops - 1.0) * 100.0 << "%";
+        if (late0 > 0) std::cout << ", late-phase GOPS " << (late1 / late0 - 1.0) * 100.0 << "%";
+        std::cout << std::noshowpos << ", throttle events " << res[0].throttle_events
+                  << " → " << res[1].throttle_events << "\n";
+    }
+    return 0;
+}
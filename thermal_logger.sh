@@ -5,8 +5,12 @@
 #
 # Usage:
 #   sudo ./thermal_logger.sh [interval_sec] [duration_sec] [output_file]
+#
+#   SYSFS_ROOT=/tmp/fake_rk3588 ./thermal_logger.sh ...
+#     → /sys 대신 fake tree 읽기 (bench --mode sim 이 만드는 RC model tree)
 # =============================================================================
 
+SYSFS_ROOT=${SYSFS_ROOT:-}
 INTERVAL=${1:-1}
 DURATION=${2:-3600}
 OUTFILE=${3:-"/tmp/thermal_log_$(date +%Y%m%d_%H%M%S).csv"}
@@ -16,7 +20,7 @@ OUTFILE=${3:-"/tmp/thermal_log_$(date +%Y%m%d_%H%M%S).csv"}
 # =============================================================================
 discover_zones() {
     echo "# Thermal zone mapping on this device:" >&2
-    for z in /sys/class/thermal/thermal_zone*/type; do
+    for z in "${SYSFS_ROOT}"/sys/class/thermal/thermal_zone*/type; do
         zid=$(echo "$z" | grep -oP 'zone\K[0-9]+')
         ztype=$(cat "$z" 2>/dev/null)
         echo "#   zone${zid}: ${ztype}" >&2
@@ -35,7 +39,7 @@ declare -a COOLING_TYPES
 discover_cooling() {
     echo "# Cooling device mapping on this device:" >&2
     local idx=0
-    for cd_path in /sys/class/thermal/cooling_device*/; do
+    for cd_path in "${SYSFS_ROOT}"/sys/class/thermal/cooling_device*/; do
         local cdid
         cdid=$(basename "$cd_path" | grep -oP '\d+')
         local cdtype max_state
@@ -53,7 +57,7 @@ discover_cooling() {
 
 read_temp() {
     local raw
-    raw=$(cat "/sys/class/thermal/thermal_zone${1}/temp" 2>/dev/null)
+    raw=$(cat "${SYSFS_ROOT}/sys/class/thermal/thermal_zone${1}/temp" 2>/dev/null)
     if [[ -n "$raw" ]]; then
         awk "BEGIN { printf \"%.1f\", $raw / 1000 }"
     else
@@ -63,31 +67,31 @@ read_temp() {
 
 read_cpu_freq() {
     local raw
-    raw=$(cat "/sys/devices/system/cpu/cpu${1}/cpufreq/scaling_cur_freq" 2>/dev/null)
+    raw=$(cat "${SYSFS_ROOT}/sys/devices/system/cpu/cpu${1}/cpufreq/scaling_cur_freq" 2>/dev/null)
     [[ -n "$raw" ]] && echo $(( raw / 1000 )) || echo "N/A"
 }
 
 read_cpu_governor() {
-    cat "/sys/devices/system/cpu/cpu${1}/cpufreq/scaling_governor" 2>/dev/null || echo "N/A"
+    cat "${SYSFS_ROOT}/sys/devices/system/cpu/cpu${1}/cpufreq/scaling_governor" 2>/dev/null || echo "N/A"
 }
 
 # ★ cooling cur_state 읽기
 #   idx: cooling_device 번호 (0, 1, 2, ...)
 read_cooling_cur_state() {
     local val
-    val=$(cat "/sys/class/thermal/cooling_device${1}/cur_state" 2>/dev/null)
+    val=$(cat "${SYSFS_ROOT}/sys/class/thermal/cooling_device${1}/cur_state" 2>/dev/null)
     [[ -n "$val" ]] && echo "$val" || echo "N/A"
 }
 
 read_cooling_max_state() {
     local val
-    val=$(cat "/sys/class/thermal/cooling_device${1}/max_state" 2>/dev/null)
+    val=$(cat "${SYSFS_ROOT}/sys/class/thermal/cooling_device${1}/max_state" 2>/dev/null)
     [[ -n "$val" ]] && echo "$val" || echo "0"
 }
 
 read_npu_load_parsed() {
     local raw
-    raw=$(cat /sys/kernel/debug/rknpu/load 2>/dev/null)
+    raw=$(cat "${SYSFS_ROOT}/sys/kernel/debug/rknpu/load" 2>/dev/null)
     if [[ -n "$raw" ]]; then
         local c0 c1 c2
         c0=$(echo "$raw" | grep -oP 'Core0:\s*\K[0-9]+')
@@ -101,7 +105,7 @@ read_npu_load_parsed() {
 
 read_npu_load() {
     local raw
-    raw=$(cat /sys/kernel/debug/rknpu/load 2>/dev/null)
+    raw=$(cat "${SYSFS_ROOT}/sys/kernel/debug/rknpu/load" 2>/dev/null)
     if [[ -n "$raw" ]]; then
         echo "$raw" | grep -oP '[0-9]+%' | tr '\n' ',' | sed 's/,$//'
     else
@@ -151,7 +155,7 @@ read_cpu_util() {
 discover_zones
 discover_cooling    # ★ cooling device 목록 수집
 
-N_ZONES=$(ls -d /sys/class/thermal/thermal_zone*/ 2>/dev/null | wc -l)
+N_ZONES=$(ls -d "${SYSFS_ROOT}"/sys/class/thermal/thermal_zone*/ 2>/dev/null | wc -l)
 
 echo "# ============================================" >&2
 echo "# RK3588 Thermal Logger v2" >&2
@@ -173,7 +177,7 @@ HEADER="timestamp,elapsed_sec"
 
 # Temperatures
 for ((z=0; z<N_ZONES; z++)); do
-    ztype=$(cat "/sys/class/thermal/thermal_zone${z}/type" 2>/dev/null | tr '-' '_')
+    ztype=$(cat "${SYSFS_ROOT}/sys/class/thermal/thermal_zone${z}/type" 2>/dev/null | tr '-' '_')
     HEADER="${HEADER},temp_${ztype}_C"
 done
 
@@ -0,0 +1,201 @@
+#pragma once
+#include <atomic>
+#include <climits>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "bench_common.h"
+#include "sysfs.h"
+
+// ============================================================
+// In-process thermal / throttle sampler
+//
+// thermal_logger.sh 는 1초 단위 + 별도 clock 이라 matmul run과
+// 매칭이 안 됨. 여기서는 side thread가 sample_ms 주기로
+//   - NPU thermal zone temp   (type에 "npu" 포함, 없으면 zone6)
+//   - NPU devfreq cur_freq    (/sys/class/devfreq/*npu*)
+//   - cooling_deviceN/cur_state
+// 를 읽어 atomic snapshot으로 publish 한다. worker/monitor는
+// latest()로 같은 bench clock 기준의 thermal state를 붙인다.
+// ============================================================
+
+constexpr int TEMP_UNKNOWN = INT_MIN;
+constexpr int MAX_COOLING  = 32;
+
+struct ThermalSnapshot {
+    uint64_t t_ns           = 0;            // bench_now_ns() at sample
+    int      npu_temp_mc    = TEMP_UNKNOWN; // milli-Celsius
+    long     npu_freq_hz    = -1;
+    int      throttle_level = 0;            // sum of cooling cur_state
+    uint32_t throttle_mask  = 0;            // bit i: cooling_device i cur_state > 0
+
+    bool   has_temp()   const { return npu_temp_mc != TEMP_UNKNOWN; }
+    double temp_c()     const { return has_temp() ? npu_temp_mc / 1000.0 : 0.0; }
+    double freq_mhz()   const { return npu_freq_hz > 0 ? npu_freq_hz / 1e6 : 0.0; }
+    bool   throttled()  const { return throttle_mask != 0; }
+};
+
+struct CoolingDevice {
+    int         id;
+    std::string type;
+    int         max_state;
+};
+
+class ThermalSampler
+{
+public:
+    ThermalSampler(const Sysfs& fs, int period_ms)
+        : fs_(fs), period_ms_(period_ms > 0 ? period_ms : 100)
+    {
+        discover();
+    }
+
+    ~ThermalSampler() { stop(); }
+
+    void start()
+    {
+        if (th_.joinable()) return;
+        sample_once();
+        running_.store(true);
+        th_ = std::thread([this] {
+            auto next = bench_clock::now();
+            while (running_.load()) {
+                next += std::chrono::milliseconds(period_ms_);
+                std::this_thread::sleep_until(next);
+                sample_once();
+            }
+        });
+    }
+
+    void stop()
+    {
+        running_.store(false);
+        if (th_.joinable()) th_.join();
+    }
+
+    // 각 필드는 relaxed load. 인접한 두 sample이 섞일 수는 있지만
+    // (sample 주기 ≪ run 주기) 태깅 용도로는 충분하다.
+    ThermalSnapshot latest() const
+    {
+        ThermalSnapshot s;
+        s.t_ns           = t_ns_.load(std::memory_order_relaxed);
+        s.npu_temp_mc    = temp_mc_.load(std::memory_order_relaxed);
+        s.npu_freq_hz    = freq_hz_.load(std::memory_order_relaxed);
+        s.throttle_level = level_.load(std::memory_order_relaxed);
+        s.throttle_mask  = mask_.load(std::memory_order_relaxed);
+        return s;
+    }
+
+    int cooling_state(int idx) const
+    {
+        return (idx >= 0 && idx < MAX_COOLING) ? states_[idx].load() : 0;
+    }
+
+    const std::vector<CoolingDevice>& cooling() const { return cooling_; }
+    const std::string& npu_zone()    const { return npu_zone_; }
+    const std::string& npu_devfreq() const { return npu_devfreq_; }
+
+    void print_config(std::ostream& os) const
+    {
+        os << "Thermal sampler: every " << period_ms_ << " ms\n"
+           << "  NPU zone    : " << (npu_zone_.empty() ? "N/A" : npu_zone_) << "\n"
+           << "  NPU devfreq : " << (npu_devfreq_.empty() ? "N/A" : npu_devfreq_) << "\n"
+           << "  Cooling     : " << cooling_.size() << " devices\n";
+        for (auto& c : cooling_)
+            os << "    cool" << c.id << ": " << c.type
+               << " (max_state=" << c.max_state << ")\n";
+    }
+
+    // "none" 또는 "L3 cool0,cool4"
+    std::string throttle_str(const ThermalSnapshot& s) const
+    {
+        if (!s.throttled()) return "none";
+        std::string out = "L" + std::to_string(s.throttle_level);
+        const char* sep = " ";
+        for (size_t i = 0; i < cooling_.size(); i++) {
+            if (s.throttle_mask & (1u << i)) {
+                out += sep + std::string("cool") + std::to_string(cooling_[i].id);
+                sep = ",";
+            }
+        }
+        return out;
+    }
+
+private:
+    void discover()
+    {
+        const std::string tz = "/sys/class/thermal/";
+        for (auto& z : fs_.list_dir(tz, "thermal_zone")) {
+            std::string type;
+            if (fs_.read_string(tz + z + "/type", type) &&
+                type.find("npu") != std::string::npos) {
+                npu_zone_ = tz + z;
+                break;
+            }
+        }
+        // thermal_logger.sh 와 동일한 fallback (RK3588: zone6 = npu_thermal)
+        if (npu_zone_.empty() && fs_.read_ll(tz + "thermal_zone6/temp") != -1)
+            npu_zone_ = tz + "thermal_zone6";
+
+        const std::string df = "/sys/class/devfreq/";
+        for (auto& d : fs_.list_dir(df)) {
+            if (d.find("npu") != std::string::npos) {
+                npu_devfreq_ = df + d;
+                break;
+            }
+        }
+
+        for (auto& c : fs_.list_dir(tz, "cooling_device")) {
+            if ((int)cooling_.size() >= MAX_COOLING) break;
+            CoolingDevice cd;
+            cd.id = std::atoi(c.c_str() + std::string("cooling_device").size());
+            if (!fs_.read_string(tz + c + "/type", cd.type)) cd.type = "unknown";
+            cd.max_state = (int)fs_.read_ll(tz + c + "/max_state", 0);
+            cooling_.push_back(cd);
+        }
+    }
+
+    void sample_once()
+    {
+        if (!npu_zone_.empty()) {
+            long long t = fs_.read_ll(npu_zone_ + "/temp", LLONG_MIN);
+            temp_mc_.store(t == LLONG_MIN ? TEMP_UNKNOWN : (int)t,
+                           std::memory_order_relaxed);
+        }
+        if (!npu_devfreq_.empty())
+            freq_hz_.store((long)fs_.read_ll(npu_devfreq_ + "/cur_freq"),
+                           std::memory_order_relaxed);
+
+        int level = 0;
+        uint32_t mask = 0;
+        for (size_t i = 0; i < cooling_.size(); i++) {
+            long long st = fs_.read_ll("/sys/class/thermal/cooling_device" +
+                                       std::to_string(cooling_[i].id) + "/cur_state", 0);
+            states_[i].store((int)st, std::memory_order_relaxed);
+            if (st > 0) {
+                level += (int)st;
+                mask |= 1u << i;
+            }
+        }
+        level_.store(level, std::memory_order_relaxed);
+        mask_.store(mask, std::memory_order_relaxed);
+        t_ns_.store(bench_now_ns(), std::memory_order_relaxed);
+    }
+
+    Sysfs fs_;
+    int   period_ms_;
+    std::string npu_zone_, npu_devfreq_;
+    std::vector<CoolingDevice> cooling_;
+
+    std::atomic<bool>     running_{false};
+    std::atomic<uint64_t> t_ns_{0};
+    std::atomic<int>      temp_mc_{TEMP_UNKNOWN};
+    std::atomic<long>     freq_hz_{-1};
+    std::atomic<int>      level_{0};
+    std::atomic<uint32_t> mask_{0};
+    std::atomic<int>      states_[MAX_COOLING] = {};
+    std::thread th_;
+};
@@ -0,0 +1,318 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "bench_common.h"
+#include "bench_config.h"
+#include "sysfs.h"
+
+// ============================================================
+// Sim mode: lumped RC thermal model → fake sysfs tree
+//
+// thermal logger / plotter 와 각 mode 의 sysfs 읽기 경로 (sampler, forecast, cooling
+// state, devfreq) 를 시험하기 위한 backend. NPU / CPU activity 는 --sim-profile 로
+// 정해지는 open-loop 입력이다: governor 의 duty 나 실제 NPU 부하는 model 에 들어가지
+// 않으므로 governor / dvfs mode 의 제어 loop 는 sim 으로 닫히지 않는다 (둘 다 여전히
+// 실제 RKNN context 로 NPU 를 돌림). 외부에서 쓴 devfreq max_freq 만 반영된다.
+// node 2개 (npu, soc) 각각 1차 RC:
+//   dT/dt = (T_inf - T) / tau
+//   T_inf = k0 + k_npu · u_npu · f_npu + k_cpu · u_cpu · f_cpu
+//     u = activity (0..1, --sim-profile), f = 현재 clock / 최대 clock
+// → k 는 "해당 부하 100% 일 때 정상상태 상승 °C" (R·P), tau = R·C.
+//
+// cooling: step_wise 흉내. 1초마다 T > trip 이면 cur_state +1,
+//          T < trip - hyst 이면 -1. state 만큼 OPP 를 내려 f 감소.
+//   cooling_device0..2 : thermal-cpufreq-0/1/2 (soc node)
+//   cooling_device3    : thermal-devfreq-0     (npu node)
+// devfreq max_freq 를 외부에서 내리면 (dvfs mode) 그것도 반영.
+//
+// 파라미터는 fit_thermal_model.py 가 thermal_log.csv 에서 뽑은
+// key=value 파일 (--sim-params) 로 덮어쓸 수 있다.
+// ============================================================
+struct RcNode {
+    double k0 = 40.0, k_npu = 30.0, k_cpu = 10.0, tau = 60.0;
+    double temp = 40.0;
+    int    state = 0;         // 이 node 가 구동하는 cooling cur_state
+
+    void step(double u_npu, double u_cpu, double dt)
+    {
+        const double t_inf = k0 + k_npu * u_npu + k_cpu * u_cpu;
+        temp += (t_inf - temp) * std::min(1.0, dt / tau);
+    }
+};
+
+struct ThermalModelParams {
+    // 기본값: npu 단독 ~78°C, both ~88°C → both 에서 NPU cooling 동작
+    RcNode npu{40.0, 38.0, 10.0, 45.0};
+    RcNode soc{40.0, 12.0, 30.0, 90.0};
+    double trip_c = 85.0;
+    double hyst_c = 5.0;
+
+    // "npu_tau=52.1" 형식, # 주석 허용. 모르는 key 는 경고만.
+    bool load(const std::string& path)
+    {
+        std::ifstream f(path);
+        if (!f) return false;
+        std::string line;
+        while (std::getline(f, line)) {
+            if (line.empty() || line[0] == '#') continue;
+            const size_t eq = line.find('=');
+            if (eq == std::string::npos) continue;
+            const std::string k = line.substr(0, eq);
+            const double v = std::atof(line.c_str() + eq + 1);
+            if      (k == "npu_k0")    npu.k0 = v;
+            else if (k == "npu_k_npu") npu.k_npu = v;
+            else if (k == "npu_k_cpu") npu.k_cpu = v;
+            else if (k == "npu_tau")   npu.tau = v;
+            else if (k == "soc_k0")    soc.k0 = v;
+            else if (k == "soc_k_npu") soc.k_npu = v;
+            else if (k == "soc_k_cpu") soc.k_cpu = v;
+            else if (k == "soc_tau")   soc.tau = v;
+            else if (k == "trip_c")    trip_c = v;
+            else if (k == "hyst_c")    hyst_c = v;
+            else std::cerr << "  unknown sim param: " << k << std::endl;
+        }
+        return true;
+    }
+};
+
+// 단계: name:seconds  (idle | cpu | npu | both)
+struct SimSegment {
+    std::string name;
+    double u_npu, u_cpu;
+    int seconds;
+};
+
+inline std::vector<SimSegment> parse_sim_profile(const std::string& s)
+{
+    std::vector<SimSegment> out;
+    for (auto& tok : parse_name_list(s)) {
+        const size_t c = tok.find(':');
+        const std::string n = tok.substr(0, c);
+        const int sec = c == std::string::npos ? 60 : std::atoi(tok.c_str() + c + 1);
+        const double un = (n == "npu" || n == "both") ? 1.0 : 0.0;
+        const double uc = (n == "cpu" || n == "both") ? 1.0 : 0.0;
+        if (n != "idle" && n != "cpu" && n != "npu" && n != "both") {
+            std::cerr << "Unknown sim segment: " << n << " (idle | cpu | npu | both)" << std::endl;
+            return {};
+        }
+        out.push_back({n, un, uc, sec});
+    }
+    return out;
+}
+
+class ThermalSim
+{
+public:
+    static constexpr int NPU_COOLING = 3;
+
+    ThermalSim(const Sysfs& fs, const ThermalModelParams& p) : fs_(fs), p_(p)
+    {
+        p_.npu.temp = p_.npu.k0;
+        p_.soc.temp = p_.soc.k0;
+    }
+
+    // RK3588 와 같은 zone / cooling / devfreq 배치로 tree 생성
+    bool create_tree()
+    {
+        static const char* zones[] = {"soc-thermal", "bigcore0-thermal", "bigcore1-thermal",
+                                      "littlecore-thermal", "center-thermal", "gpu-thermal",
+                                      "npu-thermal"};
+        bool ok = true;
+        for (int z = 0; z < 7; z++) {
+            const std::string d = "/sys/class/thermal/thermal_zone" + std::to_string(z);
+            ok &= make_dirs(fs_.path(d)) && fs_.write_string(d + "/type", zones[z])
+                  && fs_.write_string(d + "/trip_point_0_type", "passive")
+                  && fs_.write_string(d + "/trip_point_0_temp",
+                                      std::to_string((long long)(p_.trip_c * 1000)));
+        }
+        for (int c = 0; c < 4; c++) {
+            const std::string d = "/sys/class/thermal/cooling_device" + std::to_string(c);
+            const std::string type = c < 3 ? "thermal-cpufreq-" + std::to_string(c) : "thermal-devfreq-0";
+            const int max_state = (int)(c < 3 ? cpu_opps_mhz().size() : npu_opps_hz().size()) - 1;
+            ok &= make_dirs(fs_.path(d)) && fs_.write_string(d + "/type", type)
+                  && fs_.write_string(d + "/max_state", std::to_string(max_state));
+        }
+        std::string avail;
+        for (auto f : npu_opps_hz()) avail += (avail.empty() ? "" : " ") + std::to_string(f);
+        ok &= make_dirs(fs_.path(DEVFREQ))
+              && fs_.write_string(std::string(DEVFREQ) + "/available_frequencies", avail)
+              && fs_.write_string(std::string(DEVFREQ) + "/governor", "rknpu_ondemand")
+              && fs_.write_string(std::string(DEVFREQ) + "/min_freq", std::to_string(npu_opps_hz().front()))
+              && fs_.write_string(std::string(DEVFREQ) + "/max_freq", std::to_string(npu_opps_hz().back()));
+        for (int c = 0; c < 8; c++) {
+            const std::string d = "/sys/devices/system/cpu/cpu" + std::to_string(c) + "/cpufreq";
+            ok &= make_dirs(fs_.path(d)) && fs_.write_string(d + "/scaling_governor", "schedutil");
+        }
+        ok &= make_dirs(fs_.path("/sys/kernel/debug/rknpu"));
+        publish();
+        return ok;
+    }
+
+    // dt 초 진행 (cooling 은 1초 polling)
+    void step(double u_npu, double u_cpu, double dt)
+    {
+        u_npu_ = u_npu;
+        u_cpu_ = u_cpu;
+        const double fn = npu_freq_hz() / (double)npu_opps_hz().back();
+        const double fc = cpu_freq_mhz() / (double)cpu_opps_mhz().back();
+        p_.npu.step(u_npu * fn, u_cpu * fc, dt);
+        p_.soc.step(u_npu * fn, u_cpu * fc, dt);
+
+        poll_acc_ += dt;
+        if (poll_acc_ >= 1.0) {
+            poll_acc_ = 0;
+            step_wise(p_.npu, (int)npu_opps_hz().size() - 1);
+            step_wise(p_.soc, (int)cpu_opps_mhz().size() - 1);
+        }
+    }
+
+    // 현재 상태를 tree 에 기록
+    void publish()
+    {
+        const int tn = (int)(p_.npu.temp * 1000), ts = (int)(p_.soc.temp * 1000);
+        for (int z = 0; z < 7; z++)
+            put("/sys/class/thermal/thermal_zone" + std::to_string(z) + "/temp",
+                std::to_string(z == 6 ? tn : ts));
+        for (int c = 0; c < 4; c++)
+            put("/sys/class/thermal/cooling_device" + std::to_string(c) + "/cur_state",
+                std::to_string(c == NPU_COOLING ? p_.npu.state : p_.soc.state));
+        put(std::string(DEVFREQ) + "/cur_freq", std::to_string(npu_freq_hz()));
+        for (int c = 0; c < 8; c++)
+            put("/sys/devices/system/cpu/cpu" + std::to_string(c) + "/cpufreq/scaling_cur_freq",
+                std::to_string(cpu_freq_mhz(c) * 1000));
+        const int load = (int)(u_npu_ * 100);
+        std::ostringstream l;
+        l << "NPU load:  Core0: " << load << "%, Core1: " << load << "%, Core2: " << load << "%,";
+        put("/sys/kernel/debug/rknpu/load", l.str());
+    }
+
+    double npu_temp() const { return p_.npu.temp; }
+    double soc_temp() const { return p_.soc.temp; }
+    int    npu_state() const { return p_.npu.state; }
+    int    soc_state() const { return p_.soc.state; }
+
+    // cooling state 와 외부 max_freq (dvfs mode 등) 중 낮은 쪽
+    long long npu_freq_hz() const
+    {
+        const auto& o = npu_opps_hz();
+        long long f = o[std::max(0, (int)o.size() - 1 - p_.npu.state)];
+        const long long cap = fs_.read_ll(std::string(DEVFREQ) + "/max_freq");
+        return cap > 0 ? std::min(f, cap) : f;
+    }
+
+    // A76 cluster 기준 (A55 는 1800 MHz 상한)
+    int cpu_freq_mhz(int cpu = 4) const
+    {
+        const auto& o = cpu_opps_mhz();
+        const int f = o[std::max(0, (int)o.size() - 1 - p_.soc.state)];
+        return cpu < 4 ? std::min(f, 1800) : f;
+    }
+
+private:
+    static constexpr const char* DEVFREQ = "/sys/class/devfreq/fdab0000.npu";
+
+    static const std::vector<long long>& npu_opps_hz()
+    {
+        static const std::vector<long long> o = {300000000, 400000000, 500000000, 600000000,
+                                                 700000000, 800000000, 900000000, 1000000000};
+        return o;
+    }
+    static const std::vector<int>& cpu_opps_mhz()
+    {
+        static const std::vector<int> o = {408, 1008, 1416, 1800, 2016, 2256, 2400};
+        return o;
+    }
+
+    // 다른 process (logger, bench) 가 동시에 읽으므로 tmp + rename 으로 교체
+    bool put(const std::string& p, const std::string& v) const
+    {
+        const std::string tmp = p + ".tmp";
+        return fs_.write_string(tmp, v) && std::rename(fs_.path(tmp).c_str(), fs_.path(p).c_str()) == 0;
+    }
+
+    void step_wise(RcNode& n, int max_state)
+    {
+        if (n.temp > p_.trip_c)                    n.state = std::min(max_state, n.state + 1);
+        else if (n.temp < p_.trip_c - p_.hyst_c)   n.state = std::max(0, n.state - 1);
+    }
+
+    Sysfs fs_;
+    ThermalModelParams p_;
+    double u_npu_ = 0, u_cpu_ = 0;
+    double poll_acc_ = 0;
+};
+
+inline int run_thermal_sim(const BenchConfig& cfg, std::atomic<bool>& running)
+{
+    if (cfg.sysfs.root.empty()) {
+        std::cerr << "sim mode needs --sysfs-root (never writes the real /sys)" << std::endl;
+        return 1;
+    }
+    ThermalModelParams params;
+    if (!cfg.sim_params.empty() && !params.load(cfg.sim_params)) {
+        std::cerr << "Cannot read " << cfg.sim_params << std::endl;
+        return 1;
+    }
+    const auto profile = parse_sim_profile(cfg.sim_profile);
+    if (profile.empty()) return 1;
+
+    ThermalSim sim(cfg.sysfs, params);
+    if (!sim.create_tree()) {
+        std::cerr << "Cannot create fake tree under " << cfg.sysfs.root << std::endl;
+        return 1;
+    }
+
+    std::ofstream csv;
+    if (!cfg.csv_path.empty()) {
+        csv.open(cfg.csv_path);
+        csv << "sim_sec,segment,u_npu,u_cpu,npu_temp_c,soc_temp_c,npu_state,soc_state,"
+               "npu_freq_mhz,cpu_freq_mhz\n";
+    }
+
+    const double dt    = cfg.sample_ms / 1000.0;                // sim step (sim 초)
+    const double speed = std::max(0.01, cfg.sim_speed);
+    std::cout << "Thermal sim: " << cfg.sysfs.root << ", profile " << cfg.sim_profile
+              << ", x" << speed << " speed\n"
+              << "  trip " << params.trip_c << "°C (hyst " << params.hyst_c << "), tau npu "
+              << params.npu.tau << "s / soc " << params.soc.tau << "s\n";
+
+    double t = 0;
+    auto wall = bench_clock::now();
+    for (auto& seg : profile) {
+        std::cout << "\n▶ " << seg.name << " " << seg.seconds << "s" << std::endl;
+        const double seg_end = t + seg.seconds;
+        double next_print = t;
+        while (t < seg_end - 1e-9 && running.load()) {
+            sim.step(seg.u_npu, seg.u_cpu, dt);
+            sim.publish();
+            t += dt;
+            if (csv) csv << std::fixed << std::setprecision(2) << t << "," << seg.name << ","
+                         << seg.u_npu << "," << seg.u_cpu << "," << sim.npu_temp() << ","
+                         << sim.soc_temp() << "," << sim.npu_state() << "," << sim.soc_state() << ","
+                         << sim.npu_freq_hz() / 1000000 << "," << sim.cpu_freq_mhz() << "\n";
+            if (t >= next_print) {
+                next_print += 10;
+                std::cout << "  [" << std::setw(6) << std::fixed << std::setprecision(0) << t << "s]"
+                          << "  NPU " << std::setprecision(1) << sim.npu_temp() << "°C"
+                          << " @ " << sim.npu_freq_hz() / 1000000 << " MHz (state " << sim.npu_state() << ")"
+                          << "  SoC " << sim.soc_temp() << "°C @ " << sim.cpu_freq_mhz()
+                          << " MHz (state " << sim.soc_state() << ")\n";
+            }
+            wall += std::chrono::nanoseconds((int64_t)(dt / speed * 1e9));
+            std::this_thread::sleep_until(wall);
+        }
+        if (!running.load()) break;
+    }
+    std::cout << "\nSim finished at " << std::fixed << std::setprecision(0) << t
+              << "s (tree left in place: " << cfg.sysfs.root << ")\n";
+    return 0;
+}
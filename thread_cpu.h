@@ -0,0 +1,49 @@
+#pragma once
+#include <cstdint>
+#include <ctime>
+#include <sys/resource.h>
+
+// ============================================================
+// Thread CPU accounting
+//
+// CLOCK_THREAD_CPUTIME_ID : thread가 실제 CPU를 사용한 시간
+// getrusage(RUSAGE_THREAD): user / kernel 분리 + context switch 수
+//   nvcsw  = 자발적 (block/sleep → 드라이버 대기 중 잠듦)
+//   nivcsw = 비자발적 (preempt)
+// 반드시 측정 대상 thread 안에서 호출해야 한다.
+// ============================================================
+struct ThreadCpuSample {
+    uint64_t cpu_ns   = 0;
+    uint64_t user_ns  = 0;
+    uint64_t sys_ns   = 0;
+    uint64_t nvcsw    = 0;
+    uint64_t nivcsw   = 0;
+
+    ThreadCpuSample operator-(const ThreadCpuSample& o) const
+    {
+        return {cpu_ns - o.cpu_ns, user_ns - o.user_ns, sys_ns - o.sys_ns,
+                nvcsw - o.nvcsw, nivcsw - o.nivcsw};
+    }
+    ThreadCpuSample& operator+=(const ThreadCpuSample& o)
+    {
+        cpu_ns += o.cpu_ns; user_ns += o.user_ns; sys_ns += o.sys_ns;
+        nvcsw += o.nvcsw; nivcsw += o.nivcsw;
+        return *this;
+    }
+};
+
+inline ThreadCpuSample thread_cpu_now()
+{
+    ThreadCpuSample s;
+    timespec ts{};
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    s.cpu_ns = (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+
+    rusage ru{};
+    getrusage(RUSAGE_THREAD, &ru);
+    s.user_ns = (uint64_t)ru.ru_utime.tv_sec * 1000000000ULL + ru.ru_utime.tv_usec * 1000ULL;
+    s.sys_ns  = (uint64_t)ru.ru_stime.tv_sec * 1000000000ULL + ru.ru_stime.tv_usec * 1000ULL;
+    s.nvcsw   = ru.ru_nvcsw;
+    s.nivcsw  = ru.ru_nivcsw;
+    return s;
+}
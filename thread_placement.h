@@ -0,0 +1,57 @@
+#pragma once
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <pthread.h>
+#include <sched.h>
+#include <string>
+
+// ============================================================
+// Thread placement: CPU affinity + scheduling policy
+//
+// taskset -c 4-7 은 process 전체를 묶을 뿐이라 worker/monitor가
+// A76 core 사이를 migrate 한다. 여기서는 thread 단위로
+//   cpu     >= 0 : 해당 core 하나에 고정
+//   rt_prio >  0 : SCHED_FIFO + priority (root / CAP_SYS_NICE 필요)
+// 를 thread 안에서 직접 설정한다.
+// ============================================================
+struct ThreadPlacement {
+    int cpu     = -1;   // -1 = floating (process affinity 상속)
+    int rt_prio = 0;    // 0 = SCHED_OTHER
+
+    std::string str() const
+    {
+        std::string s = cpu >= 0 ? "cpu" + std::to_string(cpu) : "floating";
+        if (rt_prio > 0) s += " FIFO" + std::to_string(rt_prio);
+        return s;
+    }
+};
+
+inline bool pin_thread_to_cpu(int cpu)
+{
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+}
+
+// 현재 thread에 placement 적용. 실패 시 경고만 출력하고 계속 진행.
+inline bool apply_placement(const ThreadPlacement& p, const char* who)
+{
+    bool ok = true;
+    if (p.cpu >= 0 && !pin_thread_to_cpu(p.cpu)) {
+        std::cerr << "[" << who << "] cannot pin to cpu" << p.cpu << std::endl;
+        ok = false;
+    }
+    if (p.rt_prio > 0) {
+        sched_param sp{};
+        sp.sched_priority = p.rt_prio;
+        int err = pthread_setschedparam(pthread_self(), SCHED_FIFO, &sp);
+        if (err != 0) {
+            std::cerr << "[" << who << "] SCHED_FIFO " << p.rt_prio
+                      << " failed: " << std::strerror(err) << std::endl;
+            ok = false;
+        }
+    }
+    return ok;
+}
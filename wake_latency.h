@@ -0,0 +1,133 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "bench_common.h"
+#include "bench_config.h"
+#include "npu_matmul.h"
+#include "thermal_sampler.h"
+
+// ============================================================
+// Wake mode: idle gap 이후 첫 run latency
+//
+// stress_worker 는 back-to-back 이라 NPU가 idle로 내려가지 않아
+// runtime PM / devfreq ramp-up 비용이 보이지 않는다. 여기서는
+//   gap 동안 모든 NPU core idle → core 하나에 run 2회
+//     first  : idle 직후 (wake 비용 포함)
+//     second : 바로 이어서 (steady 기준)
+// 를 gap (ms) × core × type 마다 wake_reps 번 반복, median 비교.
+// 각 측정 직전 devfreq 값도 같이 기록 (idle 시 내려갔는지 확인).
+// ============================================================
+struct WakeSample {
+    std::string type;
+    int      core;
+    int      gap_ms;
+    int      rep;
+    uint64_t first_ns, second_ns;
+    double   freq_mhz_before;
+};
+
+inline int run_wake_sweep(const BenchConfig& cfg, ThermalSampler& sampler,
+                          std::atomic<bool>& running)
+{
+    const std::vector<int> gaps = parse_int_list(cfg.wake_gaps);
+    std::vector<rknn_tensor_type> types;
+    for (auto& t : parse_name_list(cfg.wake_types)) {
+        if      (t == "int8") types.push_back(RKNN_TENSOR_INT8);
+        else if (t == "fp16") types.push_back(RKNN_TENSOR_FLOAT16);
+        else {
+            std::cerr << "Unknown type: " << t << " (int8 | fp16)" << std::endl;
+            return 1;
+        }
+    }
+
+    std::ofstream csv;
+    if (!cfg.csv_path.empty()) {
+        csv.open(cfg.csv_path);
+        csv << "type,core,gap_ms,rep,first_us,second_us,npu_freq_mhz_before\n";
+    }
+
+    std::cout << "Wake sweep: " << cfg.M << "x" << cfg.K << "x" << cfg.N
+              << ", gaps " << cfg.wake_gaps << " ms, " << cfg.wake_reps << " reps\n";
+
+    std::vector<WakeSample> all;
+    for (auto type : types) {
+        std::vector<std::unique_ptr<RKNNMatMul>> mms;
+        for (int c = 0; c < 3; c++) {
+            mms.emplace_back(new RKNNMatMul(cfg.M, cfg.K, cfg.N, type, 1, 1, CORE_MASKS[c]));
+            if (!mms.back()->valid) {
+                std::cerr << "[Core " << c << "] Init failed!" << std::endl;
+                return 1;
+            }
+            for (int w = 0; w < 5; w++) mms.back()->run();
+        }
+
+        for (int gap : gaps) {
+            if (!running.load()) break;
+            std::cout << "  " << type_name(type) << " gap " << std::setw(5) << gap << " ms" << std::endl;
+            for (int rep = 0; rep < cfg.wake_reps && running.load(); rep++) {
+                for (int c = 0; c < 3 && running.load(); c++) {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(gap));
+                    const double f = sampler.latest().freq_mhz();
+                    auto t0 = bench_clock::now();
+                    mms[c]->run();
+                    auto t1 = bench_clock::now();
+                    mms[c]->run();
+                    auto t2 = bench_clock::now();
+
+                    WakeSample s{type_name(type), c, gap, rep,
+                                 elapsed_ns(t0, t1), elapsed_ns(t1, t2), f};
+                    all.push_back(s);
+                    if (csv) csv << s.type << "," << c << "," << gap << "," << rep << ","
+                                 << std::fixed << std::setprecision(1) << s.first_ns / 1e3 << ","
+                                 << s.second_ns / 1e3 << "," << std::setprecision(0) << f << "\n";
+                }
+            }
+        }
+    }
+
+    // ---- summary: type별 gap × core 표 (median first us, first/second 비율) ----
+    std::cout << "\n═══ Wake Latency Summary (median of " << cfg.wake_reps << ") ═══\n";
+    for (auto type : types) {
+        const std::string tn = type_name(type);
+        std::cout << "\n[" << tn << "]  first-run us (x steady)\n"
+                  << std::setw(8) << "gap ms";
+        for (int c = 0; c < 3; c++) std::cout << std::setw(22) << "core" + std::to_string(c);
+        std::cout << std::setw(12) << "freq MHz" << "\n";
+
+        for (int gap : gaps) {
+            std::cout << std::setw(8) << gap << std::fixed;
+            std::vector<uint64_t> freqs;
+            bool any = false;
+            for (int c = 0; c < 3; c++) {
+                std::vector<uint64_t> first, second;
+                for (auto& s : all) {
+                    if (s.type != tn || s.core != c || s.gap_ms != gap) continue;
+                    first.push_back(s.first_ns);
+                    second.push_back(s.second_ns);
+                    freqs.push_back((uint64_t)s.freq_mhz_before);
+                }
+                if (first.empty()) {
+                    std::cout << std::setw(22) << "-";
+                    continue;
+                }
+                any = true;
+                const double f = median_us(first), st = median_us(second);
+                std::cout << std::setw(12) << std::setprecision(1) << f
+                          << " (" << std::setw(5) << std::setprecision(2) << (st > 0 ? f / st : 0.0) << "x)";
+            }
+            std::sort(freqs.begin(), freqs.end());
+            if (any && !freqs.empty()) std::cout << std::setw(12) << freqs[freqs.size() / 2];
+            std::cout << "\n";
+        }
+    }
+    if (csv) std::cout << "\nSamples: " << cfg.csv_path << "\n";
+    return 0;
+}
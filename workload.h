@@ -0,0 +1,48 @@
+#pragma once
+#include <atomic>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "bench_common.h"
+
+// ============================================================
+// Workload: phase 단위로 시작/정지되는 부하 (NPU, CPU, ...)
+//
+//   prepare()  : context / buffer 준비 (측정 구간 밖)
+//   start(t0)  : thread 생성, 모든 thread는 t0까지 대기 후 시작
+//   total()    : t0 이후 누적 작업량 (unit 의 분자, 예: GOP)
+//   stop()     : 정지 + join (파생 클래스 소멸자에서도 호출)
+//
+// 같은 t0 를 받은 workload들은 동일 monotonic clock 에서 동시에
+// 출발하므로 phase 간/부하 간 비교가 가능하다.
+// ============================================================
+class Workload
+{
+public:
+    virtual ~Workload() = default;
+
+    virtual std::string name() const = 0;
+    virtual const char* unit() const = 0;      // "GOPS", ...
+    virtual bool prepare() { return true; }
+    virtual void start(bench_clock::time_point t0) = 0;
+    virtual double total() const = 0;
+
+    virtual void stop() { stop_threads(); }
+
+    // phase 종료 후 상세 결과 (worker별 수치 등). 기본은 없음.
+    virtual void report(std::ostream&) const {}
+
+protected:
+    void stop_threads()
+    {
+        running_.store(false);
+        for (auto& t : threads_)
+            if (t.joinable()) t.join();
+        threads_.clear();
+    }
+
+    std::atomic<bool>        running_{false};
+    std::vector<std::thread> threads_;
+};